@@ -17,9 +17,10 @@ module.exports = grammar({
   name: "spip",
 
   externals: ($) => [
-    $._content_char,
+    $._content_run,
     $._spip_ws,
     $.shorthand_lbrace,
+    $.balise_modifier, // '*' or '**', only right after a balise name
   ],
 
   extras: (_) => [],
@@ -180,14 +181,16 @@ module.exports = grammar({
         "(#",
         optional(field("namespace", $.balise_namespace)),
         field("name", $.balise_name),
-        optional(/\*{1,2}/),  // #TAG* or #TAG**
+        optional(field("modifier", $.balise_modifier)),
         repeat(seq(optional($._spip_ws), $.balise_params)),
         repeat(seq(optional($._spip_ws), $.filter)),
         optional($._spip_ws),
         ")",
       ),
 
-    balise_namespace: (_) => /_[a-zA-Z0-9_]+:/,
+    // #_loopname:TAG refers to an enclosing loop; the name is a loop_name
+    // so tags.scm can link it to <BOUCLE_loopname>.
+    balise_namespace: ($) => seq("_", field("name", $.loop_name), ":"),
     balise_name: (_) => /[A-Z][A-Z0-9_]*/,
 
     balise_params: ($) =>
@@ -201,7 +204,7 @@ module.exports = grammar({
         "#",
         optional(field("namespace", $.balise_namespace)),
         field("name", $.balise_name),
-        optional(/\*{1,2}/),
+        optional(field("modifier", $.balise_modifier)),
         repeat($.shorthand_params),
       ),
 
@@ -242,8 +245,8 @@ module.exports = grammar({
     conditional_close: (_) => "]",
 
     // ── Content (everything else = HTML) ─────────────────────
-    // The external scanner emits _content_char for characters that
-    // are not part of any SPIP construct.
-    content: ($) => prec.right(repeat1($._content_char)),
+    // The external scanner emits _content_run for runs of characters
+    // that are not part of any SPIP construct.
+    content: ($) => prec.right(repeat1($._content_run)),
   },
 });
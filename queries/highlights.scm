@@ -0,0 +1,65 @@
+; Only SPIP constructs are highlighted here; `content` nodes are left to
+; the injected HTML grammar.
+
+(comment) @comment
+
+; ── Loops ───────────────────────────────────────────────────
+
+[
+  "<BOUCLE_"
+  "</BOUCLE_"
+  "<B_"
+  "</B_"
+  "<//B_"
+  "<INCLURE"
+] @keyword
+
+(loop_name) @constant
+(loop_type) @type
+(criteria_value) @variable.parameter
+
+; ── Balises and filters ─────────────────────────────────────
+
+(balise_namespace) @module
+(balise_name) @constant.builtin
+(balise_modifier) @operator
+(filter_name) @function
+(param_content) @variable.parameter
+(include_params) @string
+
+; ── Multilingual ────────────────────────────────────────────
+
+[
+  "<multi>"
+  "</multi>"
+] @tag
+
+[
+  (lang_code)
+  (lang_code_brace)
+] @attribute
+
+(translation) @string.special
+
+; ── Punctuation ─────────────────────────────────────────────
+
+[
+  "(#"
+  "#"
+  "|"
+  (conditional_open)
+  (conditional_close)
+] @punctuation.special
+
+[
+  "("
+  ")"
+  "{"
+  "}"
+  (shorthand_lbrace)
+] @punctuation.bracket
+
+[
+  ">"
+  "/>"
+] @punctuation.delimiter
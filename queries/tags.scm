@@ -0,0 +1,21 @@
+; Loops are the only named definitions in a SPIP template.
+; <BOUCLE_x(...)> defines x; every other loop tag and each #_x: balise
+; namespace references it.
+
+(loop_open
+  name: (loop_name) @name) @definition.loop
+
+(loop_close
+  name: (loop_name) @name) @reference.loop
+
+(loop_conditional_open
+  name: (loop_name) @name) @reference.loop
+
+(loop_conditional_close
+  name: (loop_name) @name) @reference.loop
+
+(loop_alternative
+  name: (loop_name) @name) @reference.loop
+
+(balise_namespace
+  name: (loop_name) @name) @reference.loop
@@ -7,16 +7,16 @@
 #endif
 
 #define LANGUAGE_VERSION 15
-#define STATE_COUNT 143
+#define STATE_COUNT 158
 #define LARGE_STATE_COUNT 2
-#define SYMBOL_COUNT 72
+#define SYMBOL_COUNT 74
 #define ALIAS_COUNT 0
-#define TOKEN_COUNT 38
-#define EXTERNAL_TOKEN_COUNT 3
-#define FIELD_COUNT 5
+#define TOKEN_COUNT 39
+#define EXTERNAL_TOKEN_COUNT 4
+#define FIELD_COUNT 6
 #define MAX_ALIAS_SEQUENCE_LENGTH 8
 #define MAX_RESERVED_WORD_SET_SIZE 0
-#define PRODUCTION_ID_COUNT 6
+#define PRODUCTION_ID_COUNT 8
 #define SUPERTYPE_COUNT 0
 
 enum ts_symbol_identifiers {
@@ -47,50 +47,52 @@ enum ts_symbol_identifiers {
   aux_sym_translation_token1 = 25,
   anon_sym_COLON_GT = 26,
   anon_sym_LPAREN_POUND = 27,
-  aux_sym_balise_token1 = 28,
-  sym_balise_namespace = 29,
+  anon_sym__ = 28,
+  anon_sym_COLON = 29,
   sym_balise_name = 30,
   anon_sym_POUND = 31,
   anon_sym_PIPE = 32,
   sym_filter_name = 33,
   sym_conditional_open = 34,
-  sym__content_char = 35,
+  sym__content_run = 35,
   sym__spip_ws = 36,
   sym_shorthand_lbrace = 37,
-  sym_template = 38,
-  sym_comment = 39,
-  sym_loop_open = 40,
-  sym_loop_close = 41,
-  sym_loop_conditional_open = 42,
-  sym_loop_conditional_close = 43,
-  sym_loop_alternative = 44,
-  sym_criteria = 45,
-  sym_criteria_value = 46,
-  aux_sym__nested_brace_content = 47,
-  sym__deep_brace_content = 48,
-  sym_include_tag = 49,
-  sym_include_param_block = 50,
-  sym_include_params = 51,
-  sym_multi_block = 52,
-  sym_translation = 53,
-  sym_balise = 54,
-  sym_balise_params = 55,
-  sym_balise_shorthand = 56,
-  sym_shorthand_params = 57,
-  sym_filter = 58,
-  sym_filter_params = 59,
-  sym_param_content = 60,
-  sym_conditional_close = 61,
-  sym_content = 62,
-  aux_sym_template_repeat1 = 63,
-  aux_sym_loop_open_repeat1 = 64,
-  aux_sym_criteria_value_repeat1 = 65,
-  aux_sym_include_tag_repeat1 = 66,
-  aux_sym_multi_block_repeat1 = 67,
-  aux_sym_balise_repeat1 = 68,
-  aux_sym_balise_repeat2 = 69,
-  aux_sym_balise_shorthand_repeat1 = 70,
-  aux_sym_content_repeat1 = 71,
+  sym_balise_modifier = 38,
+  sym_template = 39,
+  sym_comment = 40,
+  sym_loop_open = 41,
+  sym_loop_close = 42,
+  sym_loop_conditional_open = 43,
+  sym_loop_conditional_close = 44,
+  sym_loop_alternative = 45,
+  sym_criteria = 46,
+  sym_criteria_value = 47,
+  aux_sym__nested_brace_content = 48,
+  sym__deep_brace_content = 49,
+  sym_include_tag = 50,
+  sym_include_param_block = 51,
+  sym_include_params = 52,
+  sym_multi_block = 53,
+  sym_translation = 54,
+  sym_balise = 55,
+  sym_balise_namespace = 56,
+  sym_balise_params = 57,
+  sym_balise_shorthand = 58,
+  sym_shorthand_params = 59,
+  sym_filter = 60,
+  sym_filter_params = 61,
+  sym_param_content = 62,
+  sym_conditional_close = 63,
+  sym_content = 64,
+  aux_sym_template_repeat1 = 65,
+  aux_sym_loop_open_repeat1 = 66,
+  aux_sym_criteria_value_repeat1 = 67,
+  aux_sym_include_tag_repeat1 = 68,
+  aux_sym_multi_block_repeat1 = 69,
+  aux_sym_balise_repeat1 = 70,
+  aux_sym_balise_repeat2 = 71,
+  aux_sym_balise_shorthand_repeat1 = 72,
+  aux_sym_content_repeat1 = 73,
 };
 
 static const char * const ts_symbol_names[] = {
@@ -122,16 +124,17 @@ static const char * const ts_symbol_names[] = {
   [aux_sym_translation_token1] = "translation_token1",
   [anon_sym_COLON_GT] = ":>",
   [anon_sym_LPAREN_POUND] = "(#",
-  [aux_sym_balise_token1] = "balise_token1",
-  [sym_balise_namespace] = "balise_namespace",
+  [anon_sym__] = "_",
+  [anon_sym_COLON] = ":",
   [sym_balise_name] = "balise_name",
   [anon_sym_POUND] = "#",
   [anon_sym_PIPE] = "|",
   [sym_filter_name] = "filter_name",
   [sym_conditional_open] = "conditional_open",
-  [sym__content_char] = "_content_char",
+  [sym__content_run] = "_content_run",
   [sym__spip_ws] = "_spip_ws",
   [sym_shorthand_lbrace] = "shorthand_lbrace",
+  [sym_balise_modifier] = "balise_modifier",
   [sym_template] = "template",
   [sym_comment] = "comment",
   [sym_loop_open] = "loop_open",
@@ -149,6 +152,7 @@ static const char * const ts_symbol_names[] = {
   [sym_multi_block] = "multi_block",
   [sym_translation] = "translation",
   [sym_balise] = "balise",
+  [sym_balise_namespace] = "balise_namespace",
   [sym_balise_params] = "balise_params",
   [sym_balise_shorthand] = "balise_shorthand",
   [sym_shorthand_params] = "shorthand_params",
@@ -197,16 +201,17 @@ static const TSSymbol ts_symbol_map[] = {
   [aux_sym_translation_token1] = aux_sym_translation_token1,
   [anon_sym_COLON_GT] = anon_sym_COLON_GT,
   [anon_sym_LPAREN_POUND] = anon_sym_LPAREN_POUND,
-  [aux_sym_balise_token1] = aux_sym_balise_token1,
-  [sym_balise_namespace] = sym_balise_namespace,
+  [anon_sym__] = anon_sym__,
+  [anon_sym_COLON] = anon_sym_COLON,
   [sym_balise_name] = sym_balise_name,
   [anon_sym_POUND] = anon_sym_POUND,
   [anon_sym_PIPE] = anon_sym_PIPE,
   [sym_filter_name] = sym_filter_name,
   [sym_conditional_open] = sym_conditional_open,
-  [sym__content_char] = sym__content_char,
+  [sym__content_run] = sym__content_run,
   [sym__spip_ws] = sym__spip_ws,
   [sym_shorthand_lbrace] = sym_shorthand_lbrace,
+  [sym_balise_modifier] = sym_balise_modifier,
   [sym_template] = sym_template,
   [sym_comment] = sym_comment,
   [sym_loop_open] = sym_loop_open,
@@ -224,6 +229,7 @@ static const TSSymbol ts_symbol_map[] = {
   [sym_multi_block] = sym_multi_block,
   [sym_translation] = sym_translation,
   [sym_balise] = sym_balise,
+  [sym_balise_namespace] = sym_balise_namespace,
   [sym_balise_params] = sym_balise_params,
   [sym_balise_shorthand] = sym_balise_shorthand,
   [sym_shorthand_params] = sym_shorthand_params,
@@ -356,13 +362,13 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = false,
   },
-  [aux_sym_balise_token1] = {
-    .visible = false,
+  [anon_sym__] = {
+    .visible = true,
     .named = false,
   },
-  [sym_balise_namespace] = {
+  [anon_sym_COLON] = {
     .visible = true,
-    .named = true,
+    .named = false,
   },
   [sym_balise_name] = {
     .visible = true,
@@ -384,7 +390,7 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
-  [sym__content_char] = {
+  [sym__content_run] = {
     .visible = false,
     .named = true,
   },
@@ -396,6 +402,10 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
+  [sym_balise_modifier] = {
+    .visible = true,
+    .named = true,
+  },
   [sym_template] = {
     .visible = true,
     .named = true,
@@ -464,6 +474,10 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
+  [sym_balise_namespace] = {
+    .visible = true,
+    .named = true,
+  },
   [sym_balise_params] = {
     .visible = true,
     .named = true,
@@ -535,15 +549,17 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
 };
 
 enum ts_field_identifiers {
-  field_name = 1,
-  field_namespace = 2,
-  field_params = 3,
-  field_type = 4,
-  field_value = 5,
+  field_modifier = 1,
+  field_name = 2,
+  field_namespace = 3,
+  field_params = 4,
+  field_type = 5,
+  field_value = 6,
 };
 
 static const char * const ts_field_names[] = {
   [0] = NULL,
+  [field_modifier] = "modifier",
   [field_name] = "name",
   [field_namespace] = "namespace",
   [field_params] = "params",
@@ -554,22 +570,31 @@ static const char * const ts_field_names[] = {
 static const TSMapSlice ts_field_map_slices[PRODUCTION_ID_COUNT] = {
   [1] = {.index = 0, .length = 1},
   [2] = {.index = 1, .length = 2},
-  [3] = {.index = 3, .length = 1},
-  [4] = {.index = 4, .length = 1},
-  [5] = {.index = 5, .length = 2},
+  [3] = {.index = 3, .length = 2},
+  [4] = {.index = 5, .length = 1},
+  [5] = {.index = 6, .length = 3},
+  [6] = {.index = 9, .length = 1},
+  [7] = {.index = 10, .length = 2},
 };
 
 static const TSFieldMapEntry ts_field_map_entries[] = {
   [0] =
     {field_name, 1},
   [1] =
+    {field_modifier, 2},
+    {field_name, 1},
+  [3] =
     {field_name, 2},
     {field_namespace, 1},
-  [3] =
+  [5] =
     {field_params, 1},
-  [4] =
+  [6] =
+    {field_modifier, 3},
+    {field_name, 2},
+    {field_namespace, 1},
+  [9] =
     {field_value, 1},
-  [5] =
+  [10] =
     {field_name, 1},
     {field_type, 3},
 };
@@ -726,6 +751,21 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [140] = 140,
   [141] = 141,
   [142] = 142,
+  [143] = 143,
+  [144] = 144,
+  [145] = 145,
+  [146] = 146,
+  [147] = 147,
+  [148] = 148,
+  [149] = 149,
+  [150] = 150,
+  [151] = 151,
+  [152] = 152,
+  [153] = 153,
+  [154] = 154,
+  [155] = 155,
+  [156] = 156,
+  [157] = 157,
 };
 
 static bool ts_lex(TSLexer *lexer, TSStateId state) {
@@ -733,106 +773,103 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
   eof = lexer->eof(lexer);
   switch (state) {
     case 0:
-      if (eof) ADVANCE(64);
+      if (eof) ADVANCE(61);
       ADVANCE_MAP(
-        '#', 102,
-        '(', 70,
-        ')', 71,
-        '*', 99,
-        '/', 13,
-        ':', 14,
+        '#', 95,
+        '(', 67,
+        ')', 68,
+        '/', 12,
+        ':', 93,
         '<', 5,
-        '>', 72,
-        '[', 106,
-        ']', 67,
-        '_', 79,
-        '{', 83,
-        '|', 103,
-        '}', 84,
+        '>', 69,
+        '[', 99,
+        ']', 64,
+        '_', 91,
+        '{', 76,
+        '|', 96,
+        '}', 77,
       );
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(81);
-      if (('A' <= lookahead && lookahead <= 'Z')) ADVANCE(78);
-      if (('a' <= lookahead && lookahead <= 'z')) ADVANCE(80);
+      if (('A' <= lookahead && lookahead <= 'Z')) ADVANCE(94);
       END_STATE();
     case 1:
-      if (lookahead == '#') ADVANCE(97);
+      if (lookahead == '#') ADVANCE(90);
       END_STATE();
     case 2:
-      if (lookahead == '#') ADVANCE(32);
+      if (lookahead == '#') ADVANCE(31);
       END_STATE();
     case 3:
-      if (lookahead == '(') ADVANCE(69);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
+      if (lookahead == '(') ADVANCE(66);
+      if (lookahead == ':') ADVANCE(92);
+      if (lookahead == '!' ||
+          lookahead == '*' ||
+          ('<' <= lookahead && lookahead <= '?') ||
+          ('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(82);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(97);
       END_STATE();
     case 4:
-      if (lookahead == ')') ADVANCE(65);
+      if (lookahead == ')') ADVANCE(62);
       END_STATE();
     case 5:
       if (lookahead == '/') ADVANCE(7);
-      if (lookahead == ':') ADVANCE(93);
-      if (lookahead == 'B') ADVANCE(30);
-      if (lookahead == 'I') ADVANCE(29);
-      if (lookahead == 'm') ADVANCE(49);
+      if (lookahead == ':') ADVANCE(86);
+      if (lookahead == 'B') ADVANCE(29);
+      if (lookahead == 'I') ADVANCE(28);
+      if (lookahead == 'm') ADVANCE(48);
       END_STATE();
     case 6:
-      if (lookahead == '/') ADVANCE(17);
-      if (lookahead == 'B') ADVANCE(31);
+      if (lookahead == '/') ADVANCE(16);
+      if (lookahead == 'B') ADVANCE(30);
       END_STATE();
     case 7:
-      if (lookahead == '/') ADVANCE(17);
-      if (lookahead == 'B') ADVANCE(31);
-      if (lookahead == 'm') ADVANCE(50);
+      if (lookahead == '/') ADVANCE(16);
+      if (lookahead == 'B') ADVANCE(30);
+      if (lookahead == 'm') ADVANCE(49);
       END_STATE();
     case 8:
       if (lookahead == '/') ADVANCE(6);
-      if (lookahead == ':') ADVANCE(93);
-      if (lookahead == 'B') ADVANCE(30);
-      if (lookahead == 'I') ADVANCE(29);
-      if (lookahead == 'm') ADVANCE(49);
+      if (lookahead == ':') ADVANCE(86);
+      if (lookahead == 'B') ADVANCE(29);
+      if (lookahead == 'I') ADVANCE(28);
+      if (lookahead == 'm') ADVANCE(48);
       END_STATE();
     case 9:
-      if (lookahead == '/') ADVANCE(46);
+      if (lookahead == '/') ADVANCE(45);
       if (lookahead != 0 &&
           lookahead != '<' &&
           lookahead != '[' &&
-          lookahead != '{') ADVANCE(92);
+          lookahead != '{') ADVANCE(85);
       END_STATE();
     case 10:
-      if (lookahead == '/') ADVANCE(62);
+      if (lookahead == '/') ADVANCE(59);
       if (lookahead != 0 &&
           lookahead != '<' &&
           lookahead != '[' &&
-          lookahead != '{') ADVANCE(92);
+          lookahead != '{') ADVANCE(85);
       END_STATE();
     case 11:
-      if (lookahead == ':') ADVANCE(100);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(11);
+      if (lookahead == '<') ADVANCE(9);
+      if (lookahead == '[') ADVANCE(52);
+      if (lookahead == '{') ADVANCE(55);
+      if (lookahead != 0) ADVANCE(85);
       END_STATE();
     case 12:
-      if (lookahead == '<') ADVANCE(9);
-      if (lookahead == '[') ADVANCE(53);
-      if (lookahead == '{') ADVANCE(56);
-      if (lookahead != 0) ADVANCE(92);
+      if (lookahead == '>') ADVANCE(80);
       END_STATE();
     case 13:
-      if (lookahead == '>') ADVANCE(87);
+      if (lookahead == '>') ADVANCE(89);
       END_STATE();
     case 14:
-      if (lookahead == '>') ADVANCE(96);
+      if (lookahead == '>') ADVANCE(81);
       END_STATE();
     case 15:
-      if (lookahead == '>') ADVANCE(88);
+      if (lookahead == '>') ADVANCE(82);
       END_STATE();
     case 16:
-      if (lookahead == '>') ADVANCE(89);
+      if (lookahead == 'B') ADVANCE(38);
       END_STATE();
     case 17:
-      if (lookahead == 'B') ADVANCE(39);
+      if (lookahead == 'C') ADVANCE(24);
       END_STATE();
     case 18:
       if (lookahead == 'C') ADVANCE(25);
@@ -841,343 +878,294 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
       if (lookahead == 'C') ADVANCE(26);
       END_STATE();
     case 20:
-      if (lookahead == 'C') ADVANCE(27);
+      if (lookahead == 'E') ADVANCE(27);
       END_STATE();
     case 21:
-      if (lookahead == 'E') ADVANCE(28);
+      if (lookahead == 'E') ADVANCE(79);
       END_STATE();
     case 22:
-      if (lookahead == 'E') ADVANCE(86);
+      if (lookahead == 'E') ADVANCE(39);
       END_STATE();
     case 23:
       if (lookahead == 'E') ADVANCE(40);
       END_STATE();
     case 24:
-      if (lookahead == 'E') ADVANCE(41);
+      if (lookahead == 'L') ADVANCE(34);
       END_STATE();
     case 25:
-      if (lookahead == 'L') ADVANCE(35);
+      if (lookahead == 'L') ADVANCE(22);
       END_STATE();
     case 26:
       if (lookahead == 'L') ADVANCE(23);
       END_STATE();
     case 27:
-      if (lookahead == 'L') ADVANCE(24);
+      if (lookahead == 'M') ADVANCE(4);
       END_STATE();
     case 28:
-      if (lookahead == 'M') ADVANCE(4);
+      if (lookahead == 'N') ADVANCE(17);
       END_STATE();
     case 29:
-      if (lookahead == 'N') ADVANCE(18);
+      if (lookahead == 'O') ADVANCE(33);
+      if (lookahead == '_') ADVANCE(71);
       END_STATE();
     case 30:
-      if (lookahead == 'O') ADVANCE(34);
-      if (lookahead == '_') ADVANCE(74);
+      if (lookahead == 'O') ADVANCE(35);
+      if (lookahead == '_') ADVANCE(72);
       END_STATE();
     case 31:
-      if (lookahead == 'O') ADVANCE(36);
-      if (lookahead == '_') ADVANCE(75);
+      if (lookahead == 'R') ADVANCE(20);
       END_STATE();
     case 32:
       if (lookahead == 'R') ADVANCE(21);
       END_STATE();
     case 33:
-      if (lookahead == 'R') ADVANCE(22);
+      if (lookahead == 'U') ADVANCE(18);
       END_STATE();
     case 34:
-      if (lookahead == 'U') ADVANCE(19);
+      if (lookahead == 'U') ADVANCE(32);
       END_STATE();
     case 35:
-      if (lookahead == 'U') ADVANCE(33);
+      if (lookahead == 'U') ADVANCE(19);
       END_STATE();
     case 36:
-      if (lookahead == 'U') ADVANCE(20);
+      if (lookahead == ']') ADVANCE(64);
+      if (lookahead != 0) ADVANCE(63);
       END_STATE();
     case 37:
-      if (lookahead == ']') ADVANCE(67);
-      if (lookahead != 0) ADVANCE(66);
+      if (lookahead == ']') ADVANCE(83);
       END_STATE();
     case 38:
-      if (lookahead == ']') ADVANCE(90);
+      if (lookahead == '_') ADVANCE(73);
       END_STATE();
     case 39:
-      if (lookahead == '_') ADVANCE(76);
+      if (lookahead == '_') ADVANCE(65);
       END_STATE();
     case 40:
-      if (lookahead == '_') ADVANCE(68);
+      if (lookahead == '_') ADVANCE(70);
       END_STATE();
     case 41:
-      if (lookahead == '_') ADVANCE(73);
+      if (lookahead == 'i') ADVANCE(14);
       END_STATE();
     case 42:
       if (lookahead == 'i') ADVANCE(15);
       END_STATE();
     case 43:
-      if (lookahead == 'i') ADVANCE(16);
+      if (lookahead == 'l') ADVANCE(46);
       END_STATE();
     case 44:
       if (lookahead == 'l') ADVANCE(47);
       END_STATE();
     case 45:
-      if (lookahead == 'l') ADVANCE(48);
+      if (lookahead == 'm') ADVANCE(49);
+      if (lookahead != 0) ADVANCE(85);
       END_STATE();
     case 46:
-      if (lookahead == 'm') ADVANCE(50);
-      if (lookahead != 0) ADVANCE(92);
+      if (lookahead == 't') ADVANCE(41);
       END_STATE();
     case 47:
       if (lookahead == 't') ADVANCE(42);
       END_STATE();
     case 48:
-      if (lookahead == 't') ADVANCE(43);
+      if (lookahead == 'u') ADVANCE(43);
       END_STATE();
     case 49:
       if (lookahead == 'u') ADVANCE(44);
       END_STATE();
     case 50:
-      if (lookahead == 'u') ADVANCE(45);
+      if (lookahead == '{') ADVANCE(76);
+      if (lookahead == '}') ADVANCE(77);
+      if (lookahead != 0) ADVANCE(78);
       END_STATE();
     case 51:
-      if (lookahead == '{') ADVANCE(83);
       if (lookahead == '}') ADVANCE(84);
-      if (lookahead != 0) ADVANCE(85);
       END_STATE();
     case 52:
-      if (lookahead == '}') ADVANCE(91);
+      if (('a' <= lookahead && lookahead <= 'z')) ADVANCE(53);
       END_STATE();
     case 53:
-      if (('a' <= lookahead && lookahead <= 'z')) ADVANCE(54);
+      if (('a' <= lookahead && lookahead <= 'z')) ADVANCE(37);
       END_STATE();
     case 54:
-      if (('a' <= lookahead && lookahead <= 'z')) ADVANCE(38);
+      if (('a' <= lookahead && lookahead <= 'z')) ADVANCE(51);
       END_STATE();
     case 55:
-      if (('a' <= lookahead && lookahead <= 'z')) ADVANCE(52);
+      if (('a' <= lookahead && lookahead <= 'z')) ADVANCE(54);
       END_STATE();
     case 56:
-      if (('a' <= lookahead && lookahead <= 'z')) ADVANCE(55);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(87);
       END_STATE();
     case 57:
       if (('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(94);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(88);
       END_STATE();
     case 58:
       if (('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(95);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(75);
       END_STATE();
     case 59:
-      if (lookahead == '!' ||
-          lookahead == '*' ||
-          ('<' <= lookahead && lookahead <= '?') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(104);
+      if (lookahead != 0 &&
+          lookahead != 'm') ADVANCE(85);
       END_STATE();
     case 60:
+      if (eof) ADVANCE(61);
+      if (lookahead == '#') ADVANCE(95);
+      if (lookahead == '(') ADVANCE(1);
+      if (lookahead == ':') ADVANCE(13);
+      if (lookahead == '<') ADVANCE(8);
+      if (lookahead == '[') ADVANCE(98);
+      if (lookahead == ']') ADVANCE(64);
       if (('0' <= lookahead && lookahead <= '9') ||
           ('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(81);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(74);
       END_STATE();
     case 61:
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(11);
-      END_STATE();
-    case 62:
-      if (lookahead != 0 &&
-          lookahead != 'm') ADVANCE(92);
-      END_STATE();
-    case 63:
-      if (eof) ADVANCE(64);
-      if (lookahead == '#') ADVANCE(102);
-      if (lookahead == '(') ADVANCE(1);
-      if (lookahead == '*') ADVANCE(99);
-      if (lookahead == '<') ADVANCE(8);
-      if (lookahead == '[') ADVANCE(105);
-      if (lookahead == ']') ADVANCE(67);
-      if (lookahead == '_') ADVANCE(61);
-      if (('A' <= lookahead && lookahead <= 'Z')) ADVANCE(101);
-      END_STATE();
-    case 64:
       ACCEPT_TOKEN(ts_builtin_sym_end);
       END_STATE();
-    case 65:
+    case 62:
       ACCEPT_TOKEN(anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN);
       END_STATE();
-    case 66:
+    case 63:
       ACCEPT_TOKEN(aux_sym_comment_token1);
       if (lookahead != 0 &&
-          lookahead != ']') ADVANCE(66);
+          lookahead != ']') ADVANCE(63);
       END_STATE();
-    case 67:
+    case 64:
       ACCEPT_TOKEN(anon_sym_RBRACK);
       END_STATE();
-    case 68:
+    case 65:
       ACCEPT_TOKEN(anon_sym_LTBOUCLE_);
       END_STATE();
-    case 69:
+    case 66:
       ACCEPT_TOKEN(anon_sym_LPAREN);
       END_STATE();
-    case 70:
+    case 67:
       ACCEPT_TOKEN(anon_sym_LPAREN);
-      if (lookahead == '#') ADVANCE(97);
+      if (lookahead == '#') ADVANCE(90);
       END_STATE();
-    case 71:
+    case 68:
       ACCEPT_TOKEN(anon_sym_RPAREN);
       END_STATE();
-    case 72:
+    case 69:
       ACCEPT_TOKEN(anon_sym_GT);
       END_STATE();
-    case 73:
+    case 70:
       ACCEPT_TOKEN(anon_sym_LT_SLASHBOUCLE_);
       END_STATE();
-    case 74:
+    case 71:
       ACCEPT_TOKEN(anon_sym_LTB_);
       END_STATE();
-    case 75:
+    case 72:
       ACCEPT_TOKEN(anon_sym_LT_SLASHB_);
       END_STATE();
-    case 76:
+    case 73:
       ACCEPT_TOKEN(anon_sym_LT_SLASH_SLASHB_);
       END_STATE();
-    case 77:
-      ACCEPT_TOKEN(sym_loop_name);
-      if (lookahead == ' ') ADVANCE(82);
-      if (lookahead == ':') ADVANCE(100);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(77);
-      END_STATE();
-    case 78:
-      ACCEPT_TOKEN(sym_loop_name);
-      if (lookahead == ' ') ADVANCE(82);
-      if (('a' <= lookahead && lookahead <= 'z')) ADVANCE(80);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_') ADVANCE(78);
-      END_STATE();
-    case 79:
-      ACCEPT_TOKEN(sym_loop_name);
-      if (lookahead == ' ') ADVANCE(82);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(77);
-      END_STATE();
-    case 80:
-      ACCEPT_TOKEN(sym_loop_name);
-      if (lookahead == ' ') ADVANCE(82);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(80);
-      END_STATE();
-    case 81:
+    case 74:
       ACCEPT_TOKEN(sym_loop_name);
       if (('0' <= lookahead && lookahead <= '9') ||
           ('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(81);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(74);
       END_STATE();
-    case 82:
+    case 75:
       ACCEPT_TOKEN(sym_loop_type);
       if (lookahead == ' ' ||
           ('0' <= lookahead && lookahead <= '9') ||
           ('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(82);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(75);
       END_STATE();
-    case 83:
+    case 76:
       ACCEPT_TOKEN(anon_sym_LBRACE);
       END_STATE();
-    case 84:
+    case 77:
       ACCEPT_TOKEN(anon_sym_RBRACE);
       END_STATE();
-    case 85:
+    case 78:
       ACCEPT_TOKEN(aux_sym_criteria_value_token1);
       if (lookahead != 0 &&
           lookahead != '{' &&
-          lookahead != '}') ADVANCE(85);
+          lookahead != '}') ADVANCE(78);
       END_STATE();
-    case 86:
+    case 79:
       ACCEPT_TOKEN(anon_sym_LTINCLURE);
       END_STATE();
-    case 87:
+    case 80:
       ACCEPT_TOKEN(anon_sym_SLASH_GT);
       END_STATE();
-    case 88:
+    case 81:
       ACCEPT_TOKEN(anon_sym_LTmulti_GT);
       END_STATE();
-    case 89:
+    case 82:
       ACCEPT_TOKEN(anon_sym_LT_SLASHmulti_GT);
       END_STATE();
-    case 90:
+    case 83:
       ACCEPT_TOKEN(sym_lang_code);
       END_STATE();
-    case 91:
+    case 84:
       ACCEPT_TOKEN(sym_lang_code_brace);
       END_STATE();
-    case 92:
+    case 85:
       ACCEPT_TOKEN(sym_multi_text);
       if (lookahead == '<') ADVANCE(10);
       if (lookahead != 0 &&
           lookahead != '[' &&
-          lookahead != '{') ADVANCE(92);
+          lookahead != '{') ADVANCE(85);
       END_STATE();
-    case 93:
+    case 86:
       ACCEPT_TOKEN(anon_sym_LT_COLON);
       END_STATE();
-    case 94:
+    case 87:
       ACCEPT_TOKEN(aux_sym_translation_token1);
-      if (lookahead == ':') ADVANCE(57);
-      if (lookahead == '|') ADVANCE(58);
+      if (lookahead == ':') ADVANCE(56);
+      if (lookahead == '|') ADVANCE(57);
       if (('0' <= lookahead && lookahead <= '9') ||
           ('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(94);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(87);
       END_STATE();
-    case 95:
+    case 88:
       ACCEPT_TOKEN(aux_sym_translation_token1);
-      if (lookahead == '|') ADVANCE(58);
+      if (lookahead == '|') ADVANCE(57);
       if (('0' <= lookahead && lookahead <= '9') ||
           ('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(95);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(88);
       END_STATE();
-    case 96:
+    case 89:
       ACCEPT_TOKEN(anon_sym_COLON_GT);
       END_STATE();
-    case 97:
+    case 90:
       ACCEPT_TOKEN(anon_sym_LPAREN_POUND);
       END_STATE();
-    case 98:
-      ACCEPT_TOKEN(aux_sym_balise_token1);
+    case 91:
+      ACCEPT_TOKEN(anon_sym__);
       END_STATE();
-    case 99:
-      ACCEPT_TOKEN(aux_sym_balise_token1);
-      if (lookahead == '*') ADVANCE(98);
+    case 92:
+      ACCEPT_TOKEN(anon_sym_COLON);
       END_STATE();
-    case 100:
-      ACCEPT_TOKEN(sym_balise_namespace);
+    case 93:
+      ACCEPT_TOKEN(anon_sym_COLON);
+      if (lookahead == '>') ADVANCE(89);
       END_STATE();
-    case 101:
+    case 94:
       ACCEPT_TOKEN(sym_balise_name);
       if (('0' <= lookahead && lookahead <= '9') ||
           ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_') ADVANCE(101);
+          lookahead == '_') ADVANCE(94);
       END_STATE();
-    case 102:
+    case 95:
       ACCEPT_TOKEN(anon_sym_POUND);
       END_STATE();
-    case 103:
+    case 96:
       ACCEPT_TOKEN(anon_sym_PIPE);
       END_STATE();
-    case 104:
+    case 97:
       ACCEPT_TOKEN(sym_filter_name);
       if (lookahead == '!' ||
           lookahead == '*' ||
@@ -1185,16 +1173,16 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
           ('<' <= lookahead && lookahead <= '?') ||
           ('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(104);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(97);
       END_STATE();
-    case 105:
+    case 98:
       ACCEPT_TOKEN(sym_conditional_open);
       if (lookahead == '(') ADVANCE(2);
       END_STATE();
-    case 106:
+    case 99:
       ACCEPT_TOKEN(sym_conditional_open);
       if (lookahead == '(') ADVANCE(2);
-      if (('a' <= lookahead && lookahead <= 'z')) ADVANCE(54);
+      if (('a' <= lookahead && lookahead <= 'z')) ADVANCE(53);
       END_STATE();
     default:
       return false;
@@ -1203,148 +1191,163 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
 
 static const TSLexerMode ts_lex_modes[STATE_COUNT] = {
   [0] = {.lex_state = 0, .external_lex_state = 1},
-  [1] = {.lex_state = 63, .external_lex_state = 2},
-  [2] = {.lex_state = 63, .external_lex_state = 2},
-  [3] = {.lex_state = 63, .external_lex_state = 2},
-  [4] = {.lex_state = 63, .external_lex_state = 3},
-  [5] = {.lex_state = 63, .external_lex_state = 3},
-  [6] = {.lex_state = 63, .external_lex_state = 3},
-  [7] = {.lex_state = 63, .external_lex_state = 3},
-  [8] = {.lex_state = 63, .external_lex_state = 3},
-  [9] = {.lex_state = 63, .external_lex_state = 3},
-  [10] = {.lex_state = 63, .external_lex_state = 3},
-  [11] = {.lex_state = 63, .external_lex_state = 3},
-  [12] = {.lex_state = 63, .external_lex_state = 3},
-  [13] = {.lex_state = 63, .external_lex_state = 2},
-  [14] = {.lex_state = 63, .external_lex_state = 2},
-  [15] = {.lex_state = 63, .external_lex_state = 3},
-  [16] = {.lex_state = 63, .external_lex_state = 3},
-  [17] = {.lex_state = 63, .external_lex_state = 2},
-  [18] = {.lex_state = 63, .external_lex_state = 2},
-  [19] = {.lex_state = 63, .external_lex_state = 2},
-  [20] = {.lex_state = 63, .external_lex_state = 2},
-  [21] = {.lex_state = 63, .external_lex_state = 2},
-  [22] = {.lex_state = 63, .external_lex_state = 2},
-  [23] = {.lex_state = 63, .external_lex_state = 2},
-  [24] = {.lex_state = 63, .external_lex_state = 2},
-  [25] = {.lex_state = 63, .external_lex_state = 2},
-  [26] = {.lex_state = 63, .external_lex_state = 2},
-  [27] = {.lex_state = 63, .external_lex_state = 2},
-  [28] = {.lex_state = 63, .external_lex_state = 2},
-  [29] = {.lex_state = 63, .external_lex_state = 2},
-  [30] = {.lex_state = 63, .external_lex_state = 2},
-  [31] = {.lex_state = 63, .external_lex_state = 2},
-  [32] = {.lex_state = 63, .external_lex_state = 2},
-  [33] = {.lex_state = 63, .external_lex_state = 2},
-  [34] = {.lex_state = 63, .external_lex_state = 2},
-  [35] = {.lex_state = 63, .external_lex_state = 2},
-  [36] = {.lex_state = 63, .external_lex_state = 2},
-  [37] = {.lex_state = 63, .external_lex_state = 2},
-  [38] = {.lex_state = 63, .external_lex_state = 2},
-  [39] = {.lex_state = 63, .external_lex_state = 2},
-  [40] = {.lex_state = 63, .external_lex_state = 2},
-  [41] = {.lex_state = 63, .external_lex_state = 2},
-  [42] = {.lex_state = 0, .external_lex_state = 4},
-  [43] = {.lex_state = 0, .external_lex_state = 4},
-  [44] = {.lex_state = 0, .external_lex_state = 4},
-  [45] = {.lex_state = 0, .external_lex_state = 4},
-  [46] = {.lex_state = 0, .external_lex_state = 4},
-  [47] = {.lex_state = 0, .external_lex_state = 4},
-  [48] = {.lex_state = 0, .external_lex_state = 4},
-  [49] = {.lex_state = 0, .external_lex_state = 4},
-  [50] = {.lex_state = 0, .external_lex_state = 4},
-  [51] = {.lex_state = 0, .external_lex_state = 4},
-  [52] = {.lex_state = 0, .external_lex_state = 4},
-  [53] = {.lex_state = 0},
-  [54] = {.lex_state = 0, .external_lex_state = 4},
-  [55] = {.lex_state = 0, .external_lex_state = 4},
-  [56] = {.lex_state = 0, .external_lex_state = 4},
-  [57] = {.lex_state = 12},
-  [58] = {.lex_state = 51},
-  [59] = {.lex_state = 12},
-  [60] = {.lex_state = 0, .external_lex_state = 4},
-  [61] = {.lex_state = 0},
-  [62] = {.lex_state = 0, .external_lex_state = 4},
-  [63] = {.lex_state = 0},
-  [64] = {.lex_state = 0, .external_lex_state = 4},
-  [65] = {.lex_state = 51},
+  [1] = {.lex_state = 60, .external_lex_state = 2},
+  [2] = {.lex_state = 60, .external_lex_state = 2},
+  [3] = {.lex_state = 60, .external_lex_state = 2},
+  [4] = {.lex_state = 60, .external_lex_state = 3},
+  [5] = {.lex_state = 60, .external_lex_state = 3},
+  [6] = {.lex_state = 60, .external_lex_state = 4},
+  [7] = {.lex_state = 60, .external_lex_state = 4},
+  [8] = {.lex_state = 60, .external_lex_state = 4},
+  [9] = {.lex_state = 60, .external_lex_state = 4},
+  [10] = {.lex_state = 60, .external_lex_state = 4},
+  [11] = {.lex_state = 60, .external_lex_state = 4},
+  [12] = {.lex_state = 60, .external_lex_state = 4},
+  [13] = {.lex_state = 60, .external_lex_state = 4},
+  [14] = {.lex_state = 60, .external_lex_state = 2},
+  [15] = {.lex_state = 60, .external_lex_state = 2},
+  [16] = {.lex_state = 60, .external_lex_state = 4},
+  [17] = {.lex_state = 60, .external_lex_state = 2},
+  [18] = {.lex_state = 60, .external_lex_state = 2},
+  [19] = {.lex_state = 60, .external_lex_state = 2},
+  [20] = {.lex_state = 60, .external_lex_state = 2},
+  [21] = {.lex_state = 60, .external_lex_state = 2},
+  [22] = {.lex_state = 60, .external_lex_state = 2},
+  [23] = {.lex_state = 60, .external_lex_state = 2},
+  [24] = {.lex_state = 60, .external_lex_state = 2},
+  [25] = {.lex_state = 60, .external_lex_state = 2},
+  [26] = {.lex_state = 60, .external_lex_state = 2},
+  [27] = {.lex_state = 60, .external_lex_state = 2},
+  [28] = {.lex_state = 60, .external_lex_state = 2},
+  [29] = {.lex_state = 60, .external_lex_state = 2},
+  [30] = {.lex_state = 60, .external_lex_state = 2},
+  [31] = {.lex_state = 60, .external_lex_state = 2},
+  [32] = {.lex_state = 60, .external_lex_state = 2},
+  [33] = {.lex_state = 60, .external_lex_state = 2},
+  [34] = {.lex_state = 60, .external_lex_state = 2},
+  [35] = {.lex_state = 60, .external_lex_state = 2},
+  [36] = {.lex_state = 60, .external_lex_state = 2},
+  [37] = {.lex_state = 60, .external_lex_state = 2},
+  [38] = {.lex_state = 60, .external_lex_state = 2},
+  [39] = {.lex_state = 60, .external_lex_state = 2},
+  [40] = {.lex_state = 60, .external_lex_state = 2},
+  [41] = {.lex_state = 60, .external_lex_state = 2},
+  [42] = {.lex_state = 60, .external_lex_state = 2},
+  [43] = {.lex_state = 60, .external_lex_state = 2},
+  [44] = {.lex_state = 60, .external_lex_state = 2},
+  [45] = {.lex_state = 60, .external_lex_state = 2},
+  [46] = {.lex_state = 60, .external_lex_state = 2},
+  [47] = {.lex_state = 60, .external_lex_state = 2},
+  [48] = {.lex_state = 0, .external_lex_state = 5},
+  [49] = {.lex_state = 0, .external_lex_state = 5},
+  [50] = {.lex_state = 0, .external_lex_state = 6},
+  [51] = {.lex_state = 0, .external_lex_state = 6},
+  [52] = {.lex_state = 0, .external_lex_state = 6},
+  [53] = {.lex_state = 0, .external_lex_state = 6},
+  [54] = {.lex_state = 0, .external_lex_state = 6},
+  [55] = {.lex_state = 0, .external_lex_state = 6},
+  [56] = {.lex_state = 0, .external_lex_state = 6},
+  [57] = {.lex_state = 0, .external_lex_state = 6},
+  [58] = {.lex_state = 0, .external_lex_state = 6},
+  [59] = {.lex_state = 0},
+  [60] = {.lex_state = 0, .external_lex_state = 6},
+  [61] = {.lex_state = 11},
+  [62] = {.lex_state = 50},
+  [63] = {.lex_state = 11},
+  [64] = {.lex_state = 0, .external_lex_state = 6},
+  [65] = {.lex_state = 0, .external_lex_state = 6},
   [66] = {.lex_state = 0},
-  [67] = {.lex_state = 0},
-  [68] = {.lex_state = 0, .external_lex_state = 4},
-  [69] = {.lex_state = 51},
-  [70] = {.lex_state = 0, .external_lex_state = 4},
-  [71] = {.lex_state = 0, .external_lex_state = 4},
-  [72] = {.lex_state = 12},
-  [73] = {.lex_state = 0, .external_lex_state = 4},
-  [74] = {.lex_state = 0},
-  [75] = {.lex_state = 0, .external_lex_state = 4},
-  [76] = {.lex_state = 51},
-  [77] = {.lex_state = 51},
-  [78] = {.lex_state = 51},
-  [79] = {.lex_state = 0},
-  [80] = {.lex_state = 51},
-  [81] = {.lex_state = 0, .external_lex_state = 4},
-  [82] = {.lex_state = 0, .external_lex_state = 4},
-  [83] = {.lex_state = 51},
-  [84] = {.lex_state = 0, .external_lex_state = 4},
-  [85] = {.lex_state = 51},
-  [86] = {.lex_state = 51},
-  [87] = {.lex_state = 0, .external_lex_state = 4},
-  [88] = {.lex_state = 0, .external_lex_state = 4},
-  [89] = {.lex_state = 0, .external_lex_state = 4},
-  [90] = {.lex_state = 51},
-  [91] = {.lex_state = 51},
-  [92] = {.lex_state = 0},
-  [93] = {.lex_state = 51},
-  [94] = {.lex_state = 51},
-  [95] = {.lex_state = 51},
-  [96] = {.lex_state = 0},
-  [97] = {.lex_state = 51},
-  [98] = {.lex_state = 0},
-  [99] = {.lex_state = 0, .external_lex_state = 4},
-  [100] = {.lex_state = 0},
-  [101] = {.lex_state = 0, .external_lex_state = 4},
-  [102] = {.lex_state = 51},
-  [103] = {.lex_state = 0, .external_lex_state = 4},
-  [104] = {.lex_state = 0, .external_lex_state = 4},
-  [105] = {.lex_state = 0},
-  [106] = {.lex_state = 0},
+  [67] = {.lex_state = 0, .external_lex_state = 6},
+  [68] = {.lex_state = 50},
+  [69] = {.lex_state = 0},
+  [70] = {.lex_state = 0, .external_lex_state = 6},
+  [71] = {.lex_state = 0},
+  [72] = {.lex_state = 0, .external_lex_state = 6},
+  [73] = {.lex_state = 0},
+  [74] = {.lex_state = 0, .external_lex_state = 6},
+  [75] = {.lex_state = 0},
+  [76] = {.lex_state = 50},
+  [77] = {.lex_state = 0},
+  [78] = {.lex_state = 0, .external_lex_state = 6},
+  [79] = {.lex_state = 0, .external_lex_state = 6},
+  [80] = {.lex_state = 0, .external_lex_state = 6},
+  [81] = {.lex_state = 0, .external_lex_state = 6},
+  [82] = {.lex_state = 0},
+  [83] = {.lex_state = 11},
+  [84] = {.lex_state = 0, .external_lex_state = 6},
+  [85] = {.lex_state = 0, .external_lex_state = 6},
+  [86] = {.lex_state = 50},
+  [87] = {.lex_state = 0, .external_lex_state = 6},
+  [88] = {.lex_state = 50},
+  [89] = {.lex_state = 0, .external_lex_state = 6},
+  [90] = {.lex_state = 50},
+  [91] = {.lex_state = 50},
+  [92] = {.lex_state = 0, .external_lex_state = 6},
+  [93] = {.lex_state = 0, .external_lex_state = 6},
+  [94] = {.lex_state = 50},
+  [95] = {.lex_state = 50},
+  [96] = {.lex_state = 50},
+  [97] = {.lex_state = 0},
+  [98] = {.lex_state = 0, .external_lex_state = 6},
+  [99] = {.lex_state = 0, .external_lex_state = 6},
+  [100] = {.lex_state = 50},
+  [101] = {.lex_state = 50},
+  [102] = {.lex_state = 0},
+  [103] = {.lex_state = 50},
+  [104] = {.lex_state = 0},
+  [105] = {.lex_state = 0, .external_lex_state = 6},
+  [106] = {.lex_state = 0, .external_lex_state = 6},
   [107] = {.lex_state = 0},
-  [108] = {.lex_state = 0, .external_lex_state = 4},
-  [109] = {.lex_state = 0},
-  [110] = {.lex_state = 0, .external_lex_state = 4},
+  [108] = {.lex_state = 0},
+  [109] = {.lex_state = 50},
+  [110] = {.lex_state = 0},
   [111] = {.lex_state = 0},
-  [112] = {.lex_state = 37},
+  [112] = {.lex_state = 0},
   [113] = {.lex_state = 0},
-  [114] = {.lex_state = 0},
+  [114] = {.lex_state = 0, .external_lex_state = 6},
   [115] = {.lex_state = 0},
-  [116] = {.lex_state = 63},
-  [117] = {.lex_state = 63},
-  [118] = {.lex_state = 3},
-  [119] = {.lex_state = 0},
+  [116] = {.lex_state = 0},
+  [117] = {.lex_state = 0},
+  [118] = {.lex_state = 0, .external_lex_state = 6},
+  [119] = {.lex_state = 0, .external_lex_state = 6},
   [120] = {.lex_state = 0},
-  [121] = {.lex_state = 0},
-  [122] = {.lex_state = 63},
-  [123] = {.lex_state = 60},
-  [124] = {.lex_state = 0},
+  [121] = {.lex_state = 50},
+  [122] = {.lex_state = 0, .external_lex_state = 6},
+  [123] = {.lex_state = 50},
+  [124] = {.lex_state = 50},
   [125] = {.lex_state = 0},
-  [126] = {.lex_state = 0},
+  [126] = {.lex_state = 36},
   [127] = {.lex_state = 0},
   [128] = {.lex_state = 0},
-  [129] = {.lex_state = 59},
-  [130] = {.lex_state = 57},
-  [131] = {.lex_state = 0},
-  [132] = {.lex_state = 60},
+  [129] = {.lex_state = 0},
+  [130] = {.lex_state = 0},
+  [131] = {.lex_state = 3},
+  [132] = {.lex_state = 0},
   [133] = {.lex_state = 0},
   [134] = {.lex_state = 60},
-  [135] = {.lex_state = 3},
+  [135] = {.lex_state = 0},
   [136] = {.lex_state = 0},
-  [137] = {.lex_state = 0},
-  [138] = {.lex_state = 60},
-  [139] = {.lex_state = 63},
+  [137] = {.lex_state = 3},
+  [138] = {.lex_state = 0},
+  [139] = {.lex_state = 0},
   [140] = {.lex_state = 60},
-  [141] = {.lex_state = 0},
-  [142] = {.lex_state = 0},
+  [141] = {.lex_state = 60},
+  [142] = {.lex_state = 56},
+  [143] = {.lex_state = 60},
+  [144] = {.lex_state = 0},
+  [145] = {.lex_state = 0},
+  [146] = {.lex_state = 58},
+  [147] = {.lex_state = 0},
+  [148] = {.lex_state = 0},
+  [149] = {.lex_state = 60},
+  [150] = {.lex_state = 0},
+  [151] = {.lex_state = 0},
+  [152] = {.lex_state = 60},
+  [153] = {.lex_state = 3},
+  [154] = {.lex_state = 0},
+  [155] = {.lex_state = 60},
+  [156] = {.lex_state = 0},
+  [157] = {.lex_state = 0},
 };
 
 static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
@@ -1360,8 +1363,6 @@ static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
     [anon_sym_LTB_] = ACTIONS(1),
     [anon_sym_LT_SLASHB_] = ACTIONS(1),
     [anon_sym_LT_SLASH_SLASHB_] = ACTIONS(1),
-    [sym_loop_name] = ACTIONS(1),
-    [sym_loop_type] = ACTIONS(1),
     [anon_sym_LBRACE] = ACTIONS(1),
     [anon_sym_RBRACE] = ACTIONS(1),
     [anon_sym_LTINCLURE] = ACTIONS(1),
@@ -1372,18 +1373,19 @@ static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
     [anon_sym_LT_COLON] = ACTIONS(1),
     [anon_sym_COLON_GT] = ACTIONS(1),
     [anon_sym_LPAREN_POUND] = ACTIONS(1),
-    [aux_sym_balise_token1] = ACTIONS(1),
-    [sym_balise_namespace] = ACTIONS(1),
+    [anon_sym__] = ACTIONS(1),
+    [anon_sym_COLON] = ACTIONS(1),
     [sym_balise_name] = ACTIONS(1),
     [anon_sym_POUND] = ACTIONS(1),
     [anon_sym_PIPE] = ACTIONS(1),
     [sym_conditional_open] = ACTIONS(1),
-    [sym__content_char] = ACTIONS(1),
+    [sym__content_run] = ACTIONS(1),
     [sym__spip_ws] = ACTIONS(1),
     [sym_shorthand_lbrace] = ACTIONS(1),
+    [sym_balise_modifier] = ACTIONS(1),
   },
   [STATE(1)] = {
-    [sym_template] = STATE(125),
+    [sym_template] = STATE(139),
     [sym_comment] = STATE(2),
     [sym_loop_open] = STATE(2),
     [sym_loop_close] = STATE(2),
@@ -1413,7 +1415,7 @@ static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
     [anon_sym_LPAREN_POUND] = ACTIONS(25),
     [anon_sym_POUND] = ACTIONS(27),
     [sym_conditional_open] = ACTIONS(29),
-    [sym__content_char] = ACTIONS(31),
+    [sym__content_run] = ACTIONS(31),
   },
 };
 
@@ -1444,7 +1446,7 @@ static const uint16_t ts_small_parse_table[] = {
     ACTIONS(27), 1,
       anon_sym_POUND,
     ACTIONS(31), 1,
-      sym__content_char,
+      sym__content_run,
     ACTIONS(33), 1,
       ts_builtin_sym_end,
     ACTIONS(35), 1,
@@ -1496,7 +1498,7 @@ static const uint16_t ts_small_parse_table[] = {
     ACTIONS(75), 1,
       sym_conditional_open,
     ACTIONS(78), 1,
-      sym__content_char,
+      sym__content_run,
     STATE(14), 1,
       aux_sym_content_repeat1,
     STATE(3), 14,
@@ -1516,16 +1518,16 @@ static const uint16_t ts_small_parse_table[] = {
       aux_sym_template_repeat1,
   [130] = 5,
     ACTIONS(83), 1,
-      aux_sym_balise_token1,
-    ACTIONS(85), 1,
       sym_conditional_open,
-    ACTIONS(87), 1,
+    ACTIONS(85), 1,
       sym_shorthand_lbrace,
-    STATE(6), 2,
+    ACTIONS(87), 1,
+      sym_balise_modifier,
+    STATE(11), 2,
       sym_shorthand_params,
       aux_sym_balise_shorthand_repeat1,
     ACTIONS(81), 14,
-      sym__content_char,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1540,17 +1542,17 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [160] = 5,
-    ACTIONS(87), 1,
+    ACTIONS(85), 1,
       sym_shorthand_lbrace,
     ACTIONS(91), 1,
-      aux_sym_balise_token1,
-    ACTIONS(93), 1,
       sym_conditional_open,
-    STATE(9), 2,
+    ACTIONS(93), 1,
+      sym_balise_modifier,
+    STATE(8), 2,
       sym_shorthand_params,
       aux_sym_balise_shorthand_repeat1,
     ACTIONS(89), 14,
-      sym__content_char,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1565,15 +1567,15 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [190] = 4,
-    ACTIONS(87), 1,
-      sym_shorthand_lbrace,
     ACTIONS(97), 1,
       sym_conditional_open,
-    STATE(11), 2,
+    ACTIONS(99), 1,
+      sym_shorthand_lbrace,
+    STATE(6), 2,
       sym_shorthand_params,
       aux_sym_balise_shorthand_repeat1,
     ACTIONS(95), 14,
-      sym__content_char,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1588,15 +1590,15 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [217] = 4,
-    ACTIONS(87), 1,
+    ACTIONS(85), 1,
       sym_shorthand_lbrace,
-    ACTIONS(97), 1,
+    ACTIONS(104), 1,
       sym_conditional_open,
     STATE(12), 2,
       sym_shorthand_params,
       aux_sym_balise_shorthand_repeat1,
-    ACTIONS(95), 14,
-      sym__content_char,
+    ACTIONS(102), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1611,15 +1613,15 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [244] = 4,
-    ACTIONS(87), 1,
+    ACTIONS(85), 1,
       sym_shorthand_lbrace,
-    ACTIONS(101), 1,
+    ACTIONS(108), 1,
       sym_conditional_open,
-    STATE(10), 2,
+    STATE(6), 2,
       sym_shorthand_params,
       aux_sym_balise_shorthand_repeat1,
-    ACTIONS(99), 14,
-      sym__content_char,
+    ACTIONS(106), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1634,15 +1636,15 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [271] = 4,
-    ACTIONS(87), 1,
+    ACTIONS(85), 1,
       sym_shorthand_lbrace,
-    ACTIONS(101), 1,
+    ACTIONS(112), 1,
       sym_conditional_open,
-    STATE(11), 2,
+    STATE(10), 2,
       sym_shorthand_params,
       aux_sym_balise_shorthand_repeat1,
-    ACTIONS(99), 14,
-      sym__content_char,
+    ACTIONS(110), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1657,15 +1659,15 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [298] = 4,
-    ACTIONS(87), 1,
+    ACTIONS(85), 1,
       sym_shorthand_lbrace,
-    ACTIONS(105), 1,
+    ACTIONS(116), 1,
       sym_conditional_open,
-    STATE(11), 2,
+    STATE(6), 2,
       sym_shorthand_params,
       aux_sym_balise_shorthand_repeat1,
-    ACTIONS(103), 14,
-      sym__content_char,
+    ACTIONS(114), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1680,15 +1682,15 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [325] = 4,
-    ACTIONS(109), 1,
-      sym_conditional_open,
-    ACTIONS(111), 1,
+    ACTIONS(85), 1,
       sym_shorthand_lbrace,
-    STATE(11), 2,
+    ACTIONS(120), 1,
+      sym_conditional_open,
+    STATE(6), 2,
       sym_shorthand_params,
       aux_sym_balise_shorthand_repeat1,
-    ACTIONS(107), 14,
-      sym__content_char,
+    ACTIONS(118), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1703,15 +1705,15 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [352] = 4,
-    ACTIONS(87), 1,
+    ACTIONS(85), 1,
       sym_shorthand_lbrace,
-    ACTIONS(116), 1,
+    ACTIONS(124), 1,
       sym_conditional_open,
-    STATE(11), 2,
+    STATE(6), 2,
       sym_shorthand_params,
       aux_sym_balise_shorthand_repeat1,
-    ACTIONS(114), 14,
-      sym__content_char,
+    ACTIONS(122), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1725,14 +1727,12 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LT_COLON,
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
-  [379] = 4,
-    ACTIONS(120), 1,
+  [379] = 2,
+    ACTIONS(128), 1,
       sym_conditional_open,
-    ACTIONS(122), 1,
-      sym__content_char,
-    STATE(13), 1,
-      aux_sym_content_repeat1,
-    ACTIONS(118), 13,
+    ACTIONS(126), 15,
+      sym__content_run,
+      sym_shorthand_lbrace,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1746,14 +1746,14 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LT_COLON,
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
-  [404] = 4,
-    ACTIONS(127), 1,
+  [400] = 4,
+    ACTIONS(132), 1,
       sym_conditional_open,
-    ACTIONS(129), 1,
-      sym__content_char,
-    STATE(13), 1,
+    ACTIONS(134), 1,
+      sym__content_run,
+    STATE(15), 1,
       aux_sym_content_repeat1,
-    ACTIONS(125), 13,
+    ACTIONS(130), 13,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1767,12 +1767,14 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LT_COLON,
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
-  [429] = 2,
-    ACTIONS(133), 1,
+  [425] = 4,
+    ACTIONS(138), 1,
       sym_conditional_open,
-    ACTIONS(131), 15,
-      sym__content_char,
-      sym_shorthand_lbrace,
+    ACTIONS(140), 1,
+      sym__content_run,
+    STATE(15), 1,
+      aux_sym_content_repeat1,
+    ACTIONS(136), 13,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1787,10 +1789,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [450] = 2,
-    ACTIONS(137), 1,
+    ACTIONS(145), 1,
       sym_conditional_open,
-    ACTIONS(135), 15,
-      sym__content_char,
+    ACTIONS(143), 15,
+      sym__content_run,
       sym_shorthand_lbrace,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
@@ -1806,10 +1808,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [471] = 2,
-    ACTIONS(141), 1,
+    ACTIONS(149), 1,
       sym_conditional_open,
-    ACTIONS(139), 14,
-      sym__content_char,
+    ACTIONS(147), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1824,10 +1826,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [491] = 2,
-    ACTIONS(145), 1,
+    ACTIONS(153), 1,
       sym_conditional_open,
-    ACTIONS(143), 14,
-      sym__content_char,
+    ACTIONS(151), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1842,10 +1844,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [511] = 2,
-    ACTIONS(149), 1,
+    ACTIONS(157), 1,
       sym_conditional_open,
-    ACTIONS(147), 14,
-      sym__content_char,
+    ACTIONS(155), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1860,10 +1862,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [531] = 2,
-    ACTIONS(153), 1,
+    ACTIONS(161), 1,
       sym_conditional_open,
-    ACTIONS(151), 14,
-      sym__content_char,
+    ACTIONS(159), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1878,10 +1880,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [551] = 2,
-    ACTIONS(157), 1,
+    ACTIONS(165), 1,
       sym_conditional_open,
-    ACTIONS(155), 14,
-      sym__content_char,
+    ACTIONS(163), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1896,10 +1898,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [571] = 2,
-    ACTIONS(161), 1,
+    ACTIONS(169), 1,
       sym_conditional_open,
-    ACTIONS(159), 14,
-      sym__content_char,
+    ACTIONS(167), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1914,10 +1916,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [591] = 2,
-    ACTIONS(165), 1,
+    ACTIONS(173), 1,
       sym_conditional_open,
-    ACTIONS(163), 14,
-      sym__content_char,
+    ACTIONS(171), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1932,10 +1934,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [611] = 2,
-    ACTIONS(169), 1,
+    ACTIONS(177), 1,
       sym_conditional_open,
-    ACTIONS(167), 14,
-      sym__content_char,
+    ACTIONS(175), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1950,10 +1952,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [631] = 2,
-    ACTIONS(173), 1,
+    ACTIONS(181), 1,
       sym_conditional_open,
-    ACTIONS(171), 14,
-      sym__content_char,
+    ACTIONS(179), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1968,10 +1970,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [651] = 2,
-    ACTIONS(177), 1,
+    ACTIONS(185), 1,
       sym_conditional_open,
-    ACTIONS(175), 14,
-      sym__content_char,
+    ACTIONS(183), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -1986,10 +1988,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [671] = 2,
-    ACTIONS(181), 1,
+    ACTIONS(189), 1,
       sym_conditional_open,
-    ACTIONS(179), 14,
-      sym__content_char,
+    ACTIONS(187), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2004,10 +2006,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [691] = 2,
-    ACTIONS(185), 1,
+    ACTIONS(193), 1,
       sym_conditional_open,
-    ACTIONS(183), 14,
-      sym__content_char,
+    ACTIONS(191), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2022,10 +2024,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [711] = 2,
-    ACTIONS(189), 1,
+    ACTIONS(197), 1,
       sym_conditional_open,
-    ACTIONS(187), 14,
-      sym__content_char,
+    ACTIONS(195), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2040,10 +2042,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [731] = 2,
-    ACTIONS(193), 1,
+    ACTIONS(201), 1,
       sym_conditional_open,
-    ACTIONS(191), 14,
-      sym__content_char,
+    ACTIONS(199), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2058,10 +2060,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [751] = 2,
-    ACTIONS(197), 1,
+    ACTIONS(205), 1,
       sym_conditional_open,
-    ACTIONS(195), 14,
-      sym__content_char,
+    ACTIONS(203), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2076,10 +2078,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [771] = 2,
-    ACTIONS(201), 1,
+    ACTIONS(209), 1,
       sym_conditional_open,
-    ACTIONS(199), 14,
-      sym__content_char,
+    ACTIONS(207), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2094,10 +2096,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [791] = 2,
-    ACTIONS(205), 1,
+    ACTIONS(213), 1,
       sym_conditional_open,
-    ACTIONS(203), 14,
-      sym__content_char,
+    ACTIONS(211), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2112,10 +2114,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [811] = 2,
-    ACTIONS(209), 1,
+    ACTIONS(217), 1,
       sym_conditional_open,
-    ACTIONS(207), 14,
-      sym__content_char,
+    ACTIONS(215), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2130,10 +2132,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [831] = 2,
-    ACTIONS(213), 1,
+    ACTIONS(221), 1,
       sym_conditional_open,
-    ACTIONS(211), 14,
-      sym__content_char,
+    ACTIONS(219), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2148,10 +2150,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [851] = 2,
-    ACTIONS(217), 1,
+    ACTIONS(225), 1,
       sym_conditional_open,
-    ACTIONS(215), 14,
-      sym__content_char,
+    ACTIONS(223), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2166,10 +2168,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [871] = 2,
-    ACTIONS(221), 1,
+    ACTIONS(229), 1,
       sym_conditional_open,
-    ACTIONS(219), 14,
-      sym__content_char,
+    ACTIONS(227), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2184,10 +2186,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [891] = 2,
-    ACTIONS(225), 1,
+    ACTIONS(233), 1,
       sym_conditional_open,
-    ACTIONS(223), 14,
-      sym__content_char,
+    ACTIONS(231), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2202,10 +2204,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [911] = 2,
-    ACTIONS(229), 1,
+    ACTIONS(237), 1,
       sym_conditional_open,
-    ACTIONS(227), 14,
-      sym__content_char,
+    ACTIONS(235), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2220,10 +2222,10 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [931] = 2,
-    ACTIONS(233), 1,
+    ACTIONS(241), 1,
       sym_conditional_open,
-    ACTIONS(231), 14,
-      sym__content_char,
+    ACTIONS(239), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2238,10 +2240,118 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
   [951] = 2,
-    ACTIONS(237), 1,
+    ACTIONS(245), 1,
       sym_conditional_open,
-    ACTIONS(235), 14,
-      sym__content_char,
+    ACTIONS(243), 14,
+      sym__content_run,
+      ts_builtin_sym_end,
+      anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
+      anon_sym_RBRACK,
+      anon_sym_LTBOUCLE_,
+      anon_sym_LT_SLASHBOUCLE_,
+      anon_sym_LTB_,
+      anon_sym_LT_SLASHB_,
+      anon_sym_LT_SLASH_SLASHB_,
+      anon_sym_LTINCLURE,
+      anon_sym_LTmulti_GT,
+      anon_sym_LT_COLON,
+      anon_sym_LPAREN_POUND,
+      anon_sym_POUND,
+  [971] = 2,
+    ACTIONS(249), 1,
+      sym_conditional_open,
+    ACTIONS(247), 14,
+      sym__content_run,
+      ts_builtin_sym_end,
+      anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
+      anon_sym_RBRACK,
+      anon_sym_LTBOUCLE_,
+      anon_sym_LT_SLASHBOUCLE_,
+      anon_sym_LTB_,
+      anon_sym_LT_SLASHB_,
+      anon_sym_LT_SLASH_SLASHB_,
+      anon_sym_LTINCLURE,
+      anon_sym_LTmulti_GT,
+      anon_sym_LT_COLON,
+      anon_sym_LPAREN_POUND,
+      anon_sym_POUND,
+  [991] = 2,
+    ACTIONS(253), 1,
+      sym_conditional_open,
+    ACTIONS(251), 14,
+      sym__content_run,
+      ts_builtin_sym_end,
+      anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
+      anon_sym_RBRACK,
+      anon_sym_LTBOUCLE_,
+      anon_sym_LT_SLASHBOUCLE_,
+      anon_sym_LTB_,
+      anon_sym_LT_SLASHB_,
+      anon_sym_LT_SLASH_SLASHB_,
+      anon_sym_LTINCLURE,
+      anon_sym_LTmulti_GT,
+      anon_sym_LT_COLON,
+      anon_sym_LPAREN_POUND,
+      anon_sym_POUND,
+  [1011] = 2,
+    ACTIONS(257), 1,
+      sym_conditional_open,
+    ACTIONS(255), 14,
+      sym__content_run,
+      ts_builtin_sym_end,
+      anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
+      anon_sym_RBRACK,
+      anon_sym_LTBOUCLE_,
+      anon_sym_LT_SLASHBOUCLE_,
+      anon_sym_LTB_,
+      anon_sym_LT_SLASHB_,
+      anon_sym_LT_SLASH_SLASHB_,
+      anon_sym_LTINCLURE,
+      anon_sym_LTmulti_GT,
+      anon_sym_LT_COLON,
+      anon_sym_LPAREN_POUND,
+      anon_sym_POUND,
+  [1031] = 2,
+    ACTIONS(261), 1,
+      sym_conditional_open,
+    ACTIONS(259), 14,
+      sym__content_run,
+      ts_builtin_sym_end,
+      anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
+      anon_sym_RBRACK,
+      anon_sym_LTBOUCLE_,
+      anon_sym_LT_SLASHBOUCLE_,
+      anon_sym_LTB_,
+      anon_sym_LT_SLASHB_,
+      anon_sym_LT_SLASH_SLASHB_,
+      anon_sym_LTINCLURE,
+      anon_sym_LTmulti_GT,
+      anon_sym_LT_COLON,
+      anon_sym_LPAREN_POUND,
+      anon_sym_POUND,
+  [1051] = 2,
+    ACTIONS(265), 1,
+      sym_conditional_open,
+    ACTIONS(263), 14,
+      sym__content_run,
+      ts_builtin_sym_end,
+      anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
+      anon_sym_RBRACK,
+      anon_sym_LTBOUCLE_,
+      anon_sym_LT_SLASHBOUCLE_,
+      anon_sym_LTB_,
+      anon_sym_LT_SLASHB_,
+      anon_sym_LT_SLASH_SLASHB_,
+      anon_sym_LTINCLURE,
+      anon_sym_LTmulti_GT,
+      anon_sym_LT_COLON,
+      anon_sym_LPAREN_POUND,
+      anon_sym_POUND,
+  [1071] = 2,
+    ACTIONS(269), 1,
+      sym_conditional_open,
+    ACTIONS(267), 14,
+      sym__content_run,
       ts_builtin_sym_end,
       anon_sym_LBRACK_LPAREN_POUNDREM_RPAREN,
       anon_sym_RBRACK,
@@ -2255,748 +2365,817 @@ static const uint16_t ts_small_parse_table[] = {
       anon_sym_LT_COLON,
       anon_sym_LPAREN_POUND,
       anon_sym_POUND,
-  [971] = 7,
-    ACTIONS(239), 1,
+  [1091] = 7,
+    ACTIONS(271), 1,
       anon_sym_RPAREN,
-    ACTIONS(241), 1,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(243), 1,
-      aux_sym_balise_token1,
-    ACTIONS(245), 1,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(247), 1,
+    ACTIONS(277), 1,
       sym__spip_ws,
-    STATE(47), 2,
+    ACTIONS(279), 1,
+      sym_balise_modifier,
+    STATE(50), 2,
       sym_balise_params,
       aux_sym_balise_repeat1,
-    STATE(75), 2,
+    STATE(65), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [995] = 7,
-    ACTIONS(241), 1,
+  [1115] = 7,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(245), 1,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(249), 1,
+    ACTIONS(281), 1,
       anon_sym_RPAREN,
-    ACTIONS(251), 1,
-      aux_sym_balise_token1,
-    ACTIONS(253), 1,
+    ACTIONS(283), 1,
       sym__spip_ws,
-    STATE(48), 2,
+    ACTIONS(285), 1,
+      sym_balise_modifier,
+    STATE(52), 2,
       sym_balise_params,
       aux_sym_balise_repeat1,
-    STATE(71), 2,
+    STATE(60), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1019] = 6,
-    ACTIONS(241), 1,
+  [1139] = 6,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(245), 1,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(255), 1,
+    ACTIONS(287), 1,
       anon_sym_RPAREN,
-    ACTIONS(257), 1,
+    ACTIONS(289), 1,
       sym__spip_ws,
-    STATE(46), 2,
+    STATE(57), 2,
       sym_balise_params,
       aux_sym_balise_repeat1,
-    STATE(62), 2,
+    STATE(84), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1040] = 6,
-    ACTIONS(241), 1,
+  [1160] = 6,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(245), 1,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(259), 1,
+    ACTIONS(291), 1,
       anon_sym_RPAREN,
-    ACTIONS(261), 1,
+    ACTIONS(293), 1,
       sym__spip_ws,
-    STATE(51), 2,
+    STATE(57), 2,
       sym_balise_params,
       aux_sym_balise_repeat1,
-    STATE(64), 2,
+    STATE(78), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1061] = 6,
-    ACTIONS(241), 1,
+  [1181] = 6,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(245), 1,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(263), 1,
+    ACTIONS(295), 1,
       anon_sym_RPAREN,
-    ACTIONS(265), 1,
+    ACTIONS(297), 1,
       sym__spip_ws,
-    STATE(51), 2,
+    STATE(57), 2,
       sym_balise_params,
       aux_sym_balise_repeat1,
-    STATE(70), 2,
+    STATE(72), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1082] = 6,
-    ACTIONS(241), 1,
+  [1202] = 6,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(245), 1,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(267), 1,
+    ACTIONS(299), 1,
       anon_sym_RPAREN,
-    ACTIONS(269), 1,
+    ACTIONS(301), 1,
       sym__spip_ws,
-    STATE(51), 2,
+    STATE(54), 2,
       sym_balise_params,
       aux_sym_balise_repeat1,
-    STATE(54), 2,
+    STATE(79), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1103] = 6,
-    ACTIONS(241), 1,
+  [1223] = 6,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(245), 1,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(255), 1,
+    ACTIONS(303), 1,
       anon_sym_RPAREN,
-    ACTIONS(257), 1,
+    ACTIONS(305), 1,
       sym__spip_ws,
-    STATE(51), 2,
+    STATE(57), 2,
       sym_balise_params,
       aux_sym_balise_repeat1,
-    STATE(62), 2,
+    STATE(67), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1124] = 6,
-    ACTIONS(241), 1,
+  [1244] = 6,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(245), 1,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(267), 1,
+    ACTIONS(307), 1,
       anon_sym_RPAREN,
-    ACTIONS(269), 1,
+    ACTIONS(309), 1,
       sym__spip_ws,
-    STATE(45), 2,
+    STATE(51), 2,
       sym_balise_params,
       aux_sym_balise_repeat1,
-    STATE(54), 2,
+    STATE(70), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1145] = 4,
-    ACTIONS(273), 1,
+  [1265] = 4,
+    ACTIONS(313), 1,
       anon_sym_LBRACE,
-    ACTIONS(275), 1,
+    ACTIONS(316), 1,
       sym__spip_ws,
-    ACTIONS(271), 2,
+    ACTIONS(311), 2,
       anon_sym_GT,
       anon_sym_SLASH_GT,
-    STATE(52), 2,
+    STATE(56), 2,
       sym_include_param_block,
       aux_sym_include_tag_repeat1,
-  [1160] = 4,
-    ACTIONS(279), 1,
+  [1280] = 4,
+    ACTIONS(321), 1,
       anon_sym_LBRACE,
-    ACTIONS(282), 1,
+    ACTIONS(324), 1,
       sym__spip_ws,
-    ACTIONS(277), 2,
+    ACTIONS(319), 2,
       anon_sym_RPAREN,
       anon_sym_PIPE,
-    STATE(51), 2,
+    STATE(57), 2,
       sym_balise_params,
       aux_sym_balise_repeat1,
-  [1175] = 4,
-    ACTIONS(287), 1,
+  [1295] = 4,
+    ACTIONS(329), 1,
       anon_sym_LBRACE,
-    ACTIONS(290), 1,
+    ACTIONS(331), 1,
       sym__spip_ws,
-    ACTIONS(285), 2,
+    ACTIONS(327), 2,
       anon_sym_GT,
       anon_sym_SLASH_GT,
-    STATE(52), 2,
+    STATE(56), 2,
       sym_include_param_block,
       aux_sym_include_tag_repeat1,
-  [1190] = 5,
-    ACTIONS(241), 1,
+  [1310] = 5,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(245), 1,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(293), 1,
+    ACTIONS(295), 1,
       anon_sym_RPAREN,
-    STATE(88), 1,
+    STATE(99), 1,
       sym_balise_params,
-    STATE(101), 1,
+    STATE(106), 1,
       sym_filter,
-  [1206] = 4,
-    ACTIONS(245), 1,
+  [1326] = 4,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(259), 1,
-      anon_sym_RPAREN,
     ACTIONS(295), 1,
-      sym__spip_ws,
-    STATE(56), 2,
-      sym_filter,
-      aux_sym_balise_repeat2,
-  [1220] = 3,
-    ACTIONS(299), 1,
-      anon_sym_LBRACE,
-    STATE(99), 1,
-      sym_filter_params,
-    ACTIONS(297), 3,
-      sym__spip_ws,
-      anon_sym_RPAREN,
-      anon_sym_PIPE,
-  [1232] = 4,
-    ACTIONS(301), 1,
       anon_sym_RPAREN,
-    ACTIONS(303), 1,
-      anon_sym_PIPE,
-    ACTIONS(306), 1,
+    ACTIONS(333), 1,
       sym__spip_ws,
-    STATE(56), 2,
+    STATE(85), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1246] = 3,
-    ACTIONS(309), 1,
+  [1340] = 3,
+    ACTIONS(335), 1,
       anon_sym_LT_SLASHmulti_GT,
-    STATE(72), 1,
+    STATE(83), 1,
       aux_sym_multi_block_repeat1,
-    ACTIONS(311), 3,
+    ACTIONS(337), 3,
       sym_lang_code,
       sym_lang_code_brace,
       sym_multi_text,
-  [1258] = 5,
-    ACTIONS(313), 1,
+  [1352] = 5,
+    ACTIONS(339), 1,
       anon_sym_LBRACE,
-    ACTIONS(315), 1,
+    ACTIONS(341), 1,
       anon_sym_RBRACE,
-    ACTIONS(317), 1,
+    ACTIONS(343), 1,
       aux_sym_criteria_value_token1,
-    STATE(90), 1,
+    STATE(86), 1,
       aux_sym_criteria_value_repeat1,
-    STATE(142), 1,
+    STATE(147), 1,
       sym_param_content,
-  [1274] = 3,
-    ACTIONS(319), 1,
+  [1368] = 3,
+    ACTIONS(345), 1,
       anon_sym_LT_SLASHmulti_GT,
-    STATE(57), 1,
+    STATE(61), 1,
       aux_sym_multi_block_repeat1,
-    ACTIONS(321), 3,
+    ACTIONS(347), 3,
       sym_lang_code,
       sym_lang_code_brace,
       sym_multi_text,
-  [1286] = 4,
-    ACTIONS(323), 1,
+  [1380] = 4,
+    ACTIONS(349), 1,
       anon_sym_GT,
-    ACTIONS(325), 1,
+    ACTIONS(351), 1,
       anon_sym_LBRACE,
-    ACTIONS(327), 1,
+    ACTIONS(353), 1,
       sym__spip_ws,
-    STATE(68), 2,
+    STATE(74), 2,
       sym_criteria,
       aux_sym_loop_open_repeat1,
-  [1300] = 5,
-    ACTIONS(241), 1,
-      anon_sym_LBRACE,
-    ACTIONS(245), 1,
-      anon_sym_PIPE,
-    ACTIONS(263), 1,
-      anon_sym_RPAREN,
-    STATE(88), 1,
-      sym_balise_params,
-    STATE(101), 1,
-      sym_filter,
-  [1316] = 4,
-    ACTIONS(245), 1,
+  [1394] = 4,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(263), 1,
+    ACTIONS(287), 1,
       anon_sym_RPAREN,
-    ACTIONS(329), 1,
+    ACTIONS(355), 1,
       sym__spip_ws,
-    STATE(56), 2,
+    STATE(85), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1330] = 5,
-    ACTIONS(241), 1,
+  [1408] = 5,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(245), 1,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(331), 1,
+    ACTIONS(357), 1,
       anon_sym_RPAREN,
-    STATE(88), 1,
+    STATE(99), 1,
       sym_balise_params,
-    STATE(101), 1,
+    STATE(106), 1,
       sym_filter,
-  [1346] = 4,
-    ACTIONS(245), 1,
+  [1424] = 4,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(331), 1,
+    ACTIONS(357), 1,
       anon_sym_RPAREN,
-    ACTIONS(333), 1,
+    ACTIONS(359), 1,
       sym__spip_ws,
-    STATE(56), 2,
+    STATE(85), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1360] = 5,
-    ACTIONS(313), 1,
+  [1438] = 5,
+    ACTIONS(339), 1,
       anon_sym_LBRACE,
-    ACTIONS(317), 1,
+    ACTIONS(343), 1,
       aux_sym_criteria_value_token1,
-    ACTIONS(335), 1,
+    ACTIONS(361), 1,
       anon_sym_RBRACE,
-    STATE(90), 1,
+    STATE(86), 1,
       aux_sym_criteria_value_repeat1,
-    STATE(128), 1,
+    STATE(135), 1,
       sym_param_content,
-  [1376] = 5,
-    ACTIONS(241), 1,
+  [1454] = 5,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(245), 1,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(267), 1,
+    ACTIONS(291), 1,
       anon_sym_RPAREN,
-    STATE(88), 1,
+    STATE(99), 1,
       sym_balise_params,
-    STATE(101), 1,
+    STATE(106), 1,
       sym_filter,
-  [1392] = 5,
-    ACTIONS(241), 1,
+  [1470] = 4,
+    ACTIONS(275), 1,
+      anon_sym_PIPE,
+    ACTIONS(291), 1,
+      anon_sym_RPAREN,
+    ACTIONS(363), 1,
+      sym__spip_ws,
+    STATE(85), 2,
+      sym_filter,
+      aux_sym_balise_repeat2,
+  [1484] = 5,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(245), 1,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(255), 1,
+    ACTIONS(365), 1,
       anon_sym_RPAREN,
-    STATE(88), 1,
+    STATE(99), 1,
       sym_balise_params,
-    STATE(101), 1,
+    STATE(106), 1,
+      sym_filter,
+  [1500] = 4,
+    ACTIONS(275), 1,
+      anon_sym_PIPE,
+    ACTIONS(365), 1,
+      anon_sym_RPAREN,
+    ACTIONS(367), 1,
+      sym__spip_ws,
+    STATE(85), 2,
+      sym_filter,
+      aux_sym_balise_repeat2,
+  [1514] = 5,
+    ACTIONS(273), 1,
+      anon_sym_LBRACE,
+    ACTIONS(275), 1,
+      anon_sym_PIPE,
+    ACTIONS(287), 1,
+      anon_sym_RPAREN,
+    STATE(99), 1,
+      sym_balise_params,
+    STATE(106), 1,
       sym_filter,
-  [1408] = 4,
-    ACTIONS(325), 1,
+  [1530] = 4,
+    ACTIONS(351), 1,
       anon_sym_LBRACE,
-    ACTIONS(337), 1,
+    ACTIONS(369), 1,
       anon_sym_GT,
-    ACTIONS(339), 1,
+    ACTIONS(371), 1,
       sym__spip_ws,
-    STATE(73), 2,
+    STATE(80), 2,
       sym_criteria,
       aux_sym_loop_open_repeat1,
-  [1422] = 5,
-    ACTIONS(313), 1,
+  [1544] = 5,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    ACTIONS(317), 1,
+    ACTIONS(275), 1,
+      anon_sym_PIPE,
+    ACTIONS(303), 1,
+      anon_sym_RPAREN,
+    STATE(99), 1,
+      sym_balise_params,
+    STATE(106), 1,
+      sym_filter,
+  [1560] = 5,
+    ACTIONS(339), 1,
+      anon_sym_LBRACE,
+    ACTIONS(343), 1,
       aux_sym_criteria_value_token1,
-    ACTIONS(341), 1,
+    ACTIONS(373), 1,
       anon_sym_RBRACE,
-    STATE(90), 1,
+    STATE(86), 1,
       aux_sym_criteria_value_repeat1,
-    STATE(141), 1,
+    STATE(144), 1,
       sym_param_content,
-  [1438] = 4,
-    ACTIONS(245), 1,
+  [1576] = 5,
+    ACTIONS(273), 1,
+      anon_sym_LBRACE,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(293), 1,
+    ACTIONS(375), 1,
       anon_sym_RPAREN,
-    ACTIONS(343), 1,
+    STATE(99), 1,
+      sym_balise_params,
+    STATE(106), 1,
+      sym_filter,
+  [1592] = 4,
+    ACTIONS(275), 1,
+      anon_sym_PIPE,
+    ACTIONS(375), 1,
+      anon_sym_RPAREN,
+    ACTIONS(377), 1,
       sym__spip_ws,
-    STATE(56), 2,
+    STATE(85), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1452] = 4,
-    ACTIONS(245), 1,
+  [1606] = 4,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(255), 1,
+    ACTIONS(303), 1,
       anon_sym_RPAREN,
-    ACTIONS(345), 1,
+    ACTIONS(379), 1,
       sym__spip_ws,
-    STATE(56), 2,
+    STATE(85), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1466] = 3,
-    ACTIONS(347), 1,
-      anon_sym_LT_SLASHmulti_GT,
-    STATE(72), 1,
-      aux_sym_multi_block_repeat1,
-    ACTIONS(349), 3,
-      sym_lang_code,
-      sym_lang_code_brace,
-      sym_multi_text,
-  [1478] = 4,
-    ACTIONS(352), 1,
+  [1620] = 4,
+    ACTIONS(381), 1,
       anon_sym_GT,
-    ACTIONS(354), 1,
+    ACTIONS(383), 1,
       anon_sym_LBRACE,
-    ACTIONS(357), 1,
+    ACTIONS(386), 1,
       sym__spip_ws,
-    STATE(73), 2,
+    STATE(80), 2,
       sym_criteria,
       aux_sym_loop_open_repeat1,
-  [1492] = 5,
-    ACTIONS(241), 1,
+  [1634] = 3,
+    ACTIONS(391), 1,
       anon_sym_LBRACE,
-    ACTIONS(245), 1,
+    STATE(105), 1,
+      sym_filter_params,
+    ACTIONS(389), 3,
+      sym__spip_ws,
+      anon_sym_RPAREN,
+      anon_sym_PIPE,
+  [1646] = 5,
+    ACTIONS(273), 1,
+      anon_sym_LBRACE,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(259), 1,
+    ACTIONS(393), 1,
       anon_sym_RPAREN,
-    STATE(88), 1,
+    STATE(99), 1,
       sym_balise_params,
-    STATE(101), 1,
+    STATE(106), 1,
       sym_filter,
-  [1508] = 4,
-    ACTIONS(245), 1,
+  [1662] = 3,
+    ACTIONS(395), 1,
+      anon_sym_LT_SLASHmulti_GT,
+    STATE(83), 1,
+      aux_sym_multi_block_repeat1,
+    ACTIONS(397), 3,
+      sym_lang_code,
+      sym_lang_code_brace,
+      sym_multi_text,
+  [1674] = 4,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(267), 1,
+    ACTIONS(393), 1,
       anon_sym_RPAREN,
-    ACTIONS(360), 1,
+    ACTIONS(400), 1,
       sym__spip_ws,
-    STATE(56), 2,
+    STATE(85), 2,
       sym_filter,
       aux_sym_balise_repeat2,
-  [1522] = 4,
-    ACTIONS(313), 1,
+  [1688] = 4,
+    ACTIONS(402), 1,
+      anon_sym_RPAREN,
+    ACTIONS(404), 1,
+      anon_sym_PIPE,
+    ACTIONS(407), 1,
+      sym__spip_ws,
+    STATE(85), 2,
+      sym_filter,
+      aux_sym_balise_repeat2,
+  [1702] = 4,
+    ACTIONS(339), 1,
       anon_sym_LBRACE,
-    ACTIONS(362), 1,
+    ACTIONS(410), 1,
+      anon_sym_RBRACE,
+    ACTIONS(412), 1,
       aux_sym_criteria_value_token1,
-    STATE(83), 1,
+    STATE(90), 1,
       aux_sym_criteria_value_repeat1,
-    STATE(124), 1,
-      sym_include_params,
-  [1535] = 4,
-    ACTIONS(364), 1,
+  [1715] = 3,
+    ACTIONS(329), 1,
+      anon_sym_LBRACE,
+    ACTIONS(414), 1,
+      sym__spip_ws,
+    STATE(58), 2,
+      sym_include_param_block,
+      aux_sym_include_tag_repeat1,
+  [1726] = 4,
+    ACTIONS(416), 1,
       anon_sym_LBRACE,
-    ACTIONS(366), 1,
+    ACTIONS(418), 1,
       anon_sym_RBRACE,
-    ACTIONS(368), 1,
+    ACTIONS(420), 1,
       aux_sym_criteria_value_token1,
-    STATE(86), 1,
+    STATE(101), 1,
       aux_sym__nested_brace_content,
-  [1548] = 4,
-    ACTIONS(313), 1,
+  [1739] = 1,
+    ACTIONS(422), 4,
+      sym__spip_ws,
+      anon_sym_GT,
+      anon_sym_LBRACE,
+      anon_sym_SLASH_GT,
+  [1746] = 4,
+    ACTIONS(424), 1,
       anon_sym_LBRACE,
-    ACTIONS(370), 1,
+    ACTIONS(427), 1,
+      anon_sym_RBRACE,
+    ACTIONS(429), 1,
       aux_sym_criteria_value_token1,
-    STATE(85), 1,
+    STATE(90), 1,
       aux_sym_criteria_value_repeat1,
-    STATE(131), 1,
-      sym_criteria_value,
-  [1561] = 3,
-    ACTIONS(273), 1,
-      anon_sym_LBRACE,
-    STATE(87), 1,
-      sym_include_param_block,
-    ACTIONS(372), 2,
-      anon_sym_GT,
-      anon_sym_SLASH_GT,
-  [1572] = 4,
-    ACTIONS(364), 1,
+  [1759] = 4,
+    ACTIONS(432), 1,
       anon_sym_LBRACE,
-    ACTIONS(374), 1,
+    ACTIONS(435), 1,
       anon_sym_RBRACE,
-    ACTIONS(376), 1,
+    ACTIONS(437), 1,
       aux_sym_criteria_value_token1,
-    STATE(77), 1,
+    STATE(91), 1,
       aux_sym__nested_brace_content,
-  [1585] = 1,
-    ACTIONS(378), 4,
+  [1772] = 1,
+    ACTIONS(440), 4,
       sym__spip_ws,
       anon_sym_RPAREN,
       anon_sym_LBRACE,
       anon_sym_PIPE,
-  [1592] = 1,
-    ACTIONS(380), 4,
+  [1779] = 1,
+    ACTIONS(442), 4,
       sym__spip_ws,
-      anon_sym_GT,
+      anon_sym_RPAREN,
       anon_sym_LBRACE,
-      anon_sym_SLASH_GT,
-  [1599] = 4,
-    ACTIONS(313), 1,
+      anon_sym_PIPE,
+  [1786] = 4,
+    ACTIONS(339), 1,
       anon_sym_LBRACE,
-    ACTIONS(382), 1,
-      anon_sym_RBRACE,
-    ACTIONS(384), 1,
+    ACTIONS(412), 1,
       aux_sym_criteria_value_token1,
-    STATE(91), 1,
+    ACTIONS(444), 1,
+      anon_sym_RBRACE,
+    STATE(90), 1,
       aux_sym_criteria_value_repeat1,
-  [1612] = 3,
-    ACTIONS(273), 1,
-      anon_sym_LBRACE,
-    ACTIONS(386), 1,
-      sym__spip_ws,
-    STATE(50), 2,
-      sym_include_param_block,
-      aux_sym_include_tag_repeat1,
-  [1623] = 4,
-    ACTIONS(313), 1,
+  [1799] = 4,
+    ACTIONS(339), 1,
       anon_sym_LBRACE,
-    ACTIONS(384), 1,
+    ACTIONS(412), 1,
       aux_sym_criteria_value_token1,
-    ACTIONS(388), 1,
+    ACTIONS(446), 1,
       anon_sym_RBRACE,
-    STATE(91), 1,
+    STATE(90), 1,
       aux_sym_criteria_value_repeat1,
-  [1636] = 4,
-    ACTIONS(390), 1,
+  [1812] = 4,
+    ACTIONS(339), 1,
       anon_sym_LBRACE,
-    ACTIONS(393), 1,
-      anon_sym_RBRACE,
-    ACTIONS(395), 1,
+    ACTIONS(448), 1,
       aux_sym_criteria_value_token1,
-    STATE(86), 1,
-      aux_sym__nested_brace_content,
-  [1649] = 1,
-    ACTIONS(285), 4,
-      sym__spip_ws,
-      anon_sym_GT,
+    STATE(95), 1,
+      aux_sym_criteria_value_repeat1,
+    STATE(133), 1,
+      sym_include_params,
+  [1825] = 3,
+    ACTIONS(329), 1,
       anon_sym_LBRACE,
+    STATE(98), 1,
+      sym_include_param_block,
+    ACTIONS(450), 2,
+      anon_sym_GT,
       anon_sym_SLASH_GT,
-  [1656] = 1,
-    ACTIONS(277), 4,
+  [1836] = 1,
+    ACTIONS(311), 4,
       sym__spip_ws,
-      anon_sym_RPAREN,
+      anon_sym_GT,
       anon_sym_LBRACE,
-      anon_sym_PIPE,
-  [1663] = 1,
-    ACTIONS(398), 4,
+      anon_sym_SLASH_GT,
+  [1843] = 1,
+    ACTIONS(319), 4,
       sym__spip_ws,
       anon_sym_RPAREN,
       anon_sym_LBRACE,
       anon_sym_PIPE,
-  [1670] = 4,
-    ACTIONS(313), 1,
+  [1850] = 4,
+    ACTIONS(339), 1,
       anon_sym_LBRACE,
-    ACTIONS(384), 1,
+    ACTIONS(452), 1,
       aux_sym_criteria_value_token1,
-    ACTIONS(400), 1,
-      anon_sym_RBRACE,
-    STATE(91), 1,
+    STATE(94), 1,
       aux_sym_criteria_value_repeat1,
-  [1683] = 4,
-    ACTIONS(402), 1,
+    STATE(130), 1,
+      sym_criteria_value,
+  [1863] = 4,
+    ACTIONS(416), 1,
       anon_sym_LBRACE,
-    ACTIONS(405), 1,
+    ACTIONS(454), 1,
       anon_sym_RBRACE,
-    ACTIONS(407), 1,
+    ACTIONS(456), 1,
       aux_sym_criteria_value_token1,
     STATE(91), 1,
-      aux_sym_criteria_value_repeat1,
-  [1696] = 3,
-    ACTIONS(325), 1,
+      aux_sym__nested_brace_content,
+  [1876] = 3,
+    ACTIONS(351), 1,
       anon_sym_LBRACE,
-    ACTIONS(410), 1,
+    ACTIONS(458), 1,
       anon_sym_GT,
-    STATE(108), 1,
+    STATE(118), 1,
       sym_criteria,
-  [1706] = 1,
-    ACTIONS(412), 3,
-      anon_sym_LBRACE,
-      anon_sym_RBRACE,
-      aux_sym_criteria_value_token1,
-  [1712] = 3,
-    ACTIONS(414), 1,
-      anon_sym_RBRACE,
-    ACTIONS(416), 1,
-      aux_sym_criteria_value_token1,
-    STATE(126), 1,
-      sym__deep_brace_content,
-  [1722] = 1,
-    ACTIONS(393), 3,
+  [1886] = 1,
+    ACTIONS(460), 3,
       anon_sym_LBRACE,
       anon_sym_RBRACE,
       aux_sym_criteria_value_token1,
-  [1728] = 3,
-    ACTIONS(245), 1,
-      anon_sym_PIPE,
-    ACTIONS(331), 1,
-      anon_sym_RPAREN,
-    STATE(101), 1,
-      sym_filter,
-  [1738] = 1,
-    ACTIONS(405), 3,
-      anon_sym_LBRACE,
-      anon_sym_RBRACE,
-      aux_sym_criteria_value_token1,
-  [1744] = 3,
-    ACTIONS(245), 1,
+  [1892] = 3,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(263), 1,
+    ACTIONS(357), 1,
       anon_sym_RPAREN,
-    STATE(101), 1,
+    STATE(106), 1,
       sym_filter,
-  [1754] = 1,
-    ACTIONS(418), 3,
+  [1902] = 1,
+    ACTIONS(462), 3,
       sym__spip_ws,
       anon_sym_RPAREN,
       anon_sym_PIPE,
-  [1760] = 3,
-    ACTIONS(325), 1,
-      anon_sym_LBRACE,
-    ACTIONS(337), 1,
-      anon_sym_GT,
-    STATE(108), 1,
-      sym_criteria,
-  [1770] = 1,
-    ACTIONS(301), 3,
+  [1908] = 1,
+    ACTIONS(402), 3,
       sym__spip_ws,
       anon_sym_RPAREN,
       anon_sym_PIPE,
-  [1776] = 1,
-    ACTIONS(420), 3,
+  [1914] = 3,
+    ACTIONS(275), 1,
+      anon_sym_PIPE,
+    ACTIONS(464), 1,
+      anon_sym_RPAREN,
+    STATE(106), 1,
+      sym_filter,
+  [1924] = 3,
+    ACTIONS(466), 1,
+      anon_sym__,
+    ACTIONS(468), 1,
+      sym_balise_name,
+    STATE(157), 1,
+      sym_balise_namespace,
+  [1934] = 1,
+    ACTIONS(470), 3,
       anon_sym_LBRACE,
       anon_sym_RBRACE,
       aux_sym_criteria_value_token1,
-  [1782] = 1,
-    ACTIONS(422), 3,
-      sym__spip_ws,
-      anon_sym_RPAREN,
+  [1940] = 3,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-  [1788] = 1,
-    ACTIONS(424), 3,
-      sym__spip_ws,
+    ACTIONS(365), 1,
       anon_sym_RPAREN,
+    STATE(106), 1,
+      sym_filter,
+  [1950] = 3,
+    ACTIONS(351), 1,
+      anon_sym_LBRACE,
+    ACTIONS(369), 1,
+      anon_sym_GT,
+    STATE(118), 1,
+      sym_criteria,
+  [1960] = 3,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-  [1794] = 3,
-    ACTIONS(245), 1,
+    ACTIONS(393), 1,
+      anon_sym_RPAREN,
+    STATE(106), 1,
+      sym_filter,
+  [1970] = 3,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(293), 1,
+    ACTIONS(472), 1,
       anon_sym_RPAREN,
-    STATE(101), 1,
+    STATE(106), 1,
       sym_filter,
-  [1804] = 3,
-    ACTIONS(245), 1,
+  [1980] = 1,
+    ACTIONS(474), 3,
+      sym__spip_ws,
+      anon_sym_RPAREN,
+      anon_sym_PIPE,
+  [1986] = 3,
+    ACTIONS(466), 1,
+      anon_sym__,
+    ACTIONS(476), 1,
+      sym_balise_name,
+    STATE(138), 1,
+      sym_balise_namespace,
+  [1996] = 3,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(426), 1,
+    ACTIONS(375), 1,
       anon_sym_RPAREN,
-    STATE(101), 1,
+    STATE(106), 1,
       sym_filter,
-  [1814] = 3,
-    ACTIONS(245), 1,
+  [2006] = 3,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(259), 1,
+    ACTIONS(478), 1,
       anon_sym_RPAREN,
-    STATE(101), 1,
+    STATE(106), 1,
       sym_filter,
-  [1824] = 1,
-    ACTIONS(352), 3,
+  [2016] = 1,
+    ACTIONS(381), 3,
       sym__spip_ws,
       anon_sym_GT,
       anon_sym_LBRACE,
-  [1830] = 3,
-    ACTIONS(245), 1,
+  [2022] = 1,
+    ACTIONS(480), 3,
+      sym__spip_ws,
+      anon_sym_RPAREN,
+      anon_sym_PIPE,
+  [2028] = 3,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    ACTIONS(428), 1,
+    ACTIONS(482), 1,
       anon_sym_RPAREN,
-    STATE(101), 1,
+    STATE(106), 1,
       sym_filter,
-  [1840] = 1,
-    ACTIONS(430), 3,
+  [2038] = 3,
+    ACTIONS(484), 1,
+      anon_sym_RBRACE,
+    ACTIONS(486), 1,
+      aux_sym_criteria_value_token1,
+    STATE(145), 1,
+      sym__deep_brace_content,
+  [2048] = 1,
+    ACTIONS(488), 3,
       sym__spip_ws,
       anon_sym_GT,
       anon_sym_LBRACE,
-  [1846] = 2,
-    ACTIONS(273), 1,
+  [2054] = 1,
+    ACTIONS(427), 3,
+      anon_sym_LBRACE,
+      anon_sym_RBRACE,
+      aux_sym_criteria_value_token1,
+  [2060] = 1,
+    ACTIONS(435), 3,
       anon_sym_LBRACE,
-    STATE(87), 1,
+      anon_sym_RBRACE,
+      aux_sym_criteria_value_token1,
+  [2066] = 2,
+    ACTIONS(329), 1,
+      anon_sym_LBRACE,
+    STATE(98), 1,
       sym_include_param_block,
-  [1853] = 2,
-    ACTIONS(432), 1,
+  [2073] = 2,
+    ACTIONS(490), 1,
       aux_sym_comment_token1,
-    ACTIONS(434), 1,
+    ACTIONS(492), 1,
       anon_sym_RBRACK,
-  [1860] = 2,
-    ACTIONS(325), 1,
-      anon_sym_LBRACE,
-    STATE(108), 1,
-      sym_criteria,
-  [1867] = 2,
-    ACTIONS(241), 1,
+  [2080] = 2,
+    ACTIONS(273), 1,
       anon_sym_LBRACE,
-    STATE(88), 1,
+    STATE(99), 1,
       sym_balise_params,
-  [1874] = 2,
-    ACTIONS(245), 1,
+  [2087] = 2,
+    ACTIONS(275), 1,
       anon_sym_PIPE,
-    STATE(101), 1,
+    STATE(106), 1,
       sym_filter,
-  [1881] = 2,
-    ACTIONS(436), 1,
-      sym_balise_namespace,
-    ACTIONS(438), 1,
-      sym_balise_name,
-  [1888] = 2,
-    ACTIONS(440), 1,
-      sym_balise_namespace,
-    ACTIONS(442), 1,
-      sym_balise_name,
-  [1895] = 1,
-    ACTIONS(444), 1,
-      sym_loop_type,
-  [1899] = 1,
-    ACTIONS(446), 1,
-      anon_sym_RPAREN,
-  [1903] = 1,
-    ACTIONS(448), 1,
-      anon_sym_GT,
-  [1907] = 1,
-    ACTIONS(450), 1,
-      anon_sym_GT,
-  [1911] = 1,
-    ACTIONS(452), 1,
+  [2094] = 2,
+    ACTIONS(351), 1,
+      anon_sym_LBRACE,
+    STATE(118), 1,
+      sym_criteria,
+  [2101] = 1,
+    ACTIONS(494), 1,
+      anon_sym_RBRACE,
+  [2105] = 1,
+    ACTIONS(496), 1,
+      anon_sym_LPAREN,
+  [2109] = 1,
+    ACTIONS(498), 1,
       sym_balise_name,
-  [1915] = 1,
-    ACTIONS(454), 1,
-      sym_loop_name,
-  [1919] = 1,
-    ACTIONS(456), 1,
+  [2113] = 1,
+    ACTIONS(500), 1,
       anon_sym_RBRACE,
-  [1923] = 1,
-    ACTIONS(458), 1,
-      ts_builtin_sym_end,
-  [1927] = 1,
-    ACTIONS(460), 1,
+  [2117] = 1,
+    ACTIONS(502), 1,
+      sym_loop_name,
+  [2121] = 1,
+    ACTIONS(504), 1,
       anon_sym_RBRACE,
-  [1931] = 1,
-    ACTIONS(462), 1,
+  [2125] = 1,
+    ACTIONS(506), 1,
       anon_sym_GT,
-  [1935] = 1,
-    ACTIONS(464), 1,
-      anon_sym_RBRACE,
-  [1939] = 1,
-    ACTIONS(466), 1,
+  [2129] = 1,
+    ACTIONS(508), 1,
       sym_filter_name,
-  [1943] = 1,
-    ACTIONS(468), 1,
+  [2133] = 1,
+    ACTIONS(510), 1,
+      sym_balise_name,
+  [2137] = 1,
+    ACTIONS(512), 1,
+      ts_builtin_sym_end,
+  [2141] = 1,
+    ACTIONS(514), 1,
+      sym_loop_name,
+  [2145] = 1,
+    ACTIONS(516), 1,
+      sym_loop_name,
+  [2149] = 1,
+    ACTIONS(518), 1,
       aux_sym_translation_token1,
-  [1947] = 1,
-    ACTIONS(470), 1,
+  [2153] = 1,
+    ACTIONS(520), 1,
+      sym_loop_name,
+  [2157] = 1,
+    ACTIONS(522), 1,
       anon_sym_RBRACE,
-  [1951] = 1,
-    ACTIONS(472), 1,
+  [2161] = 1,
+    ACTIONS(524), 1,
+      anon_sym_RBRACE,
+  [2165] = 1,
+    ACTIONS(526), 1,
+      sym_loop_type,
+  [2169] = 1,
+    ACTIONS(528), 1,
+      anon_sym_RBRACE,
+  [2173] = 1,
+    ACTIONS(530), 1,
+      anon_sym_RBRACK,
+  [2177] = 1,
+    ACTIONS(532), 1,
       sym_loop_name,
-  [1955] = 1,
-    ACTIONS(474), 1,
+  [2181] = 1,
+    ACTIONS(534), 1,
+      anon_sym_GT,
+  [2185] = 1,
+    ACTIONS(536), 1,
+      anon_sym_RPAREN,
+  [2189] = 1,
+    ACTIONS(538), 1,
       anon_sym_COLON_GT,
-  [1959] = 1,
-    ACTIONS(476), 1,
-      sym_loop_name,
-  [1963] = 1,
-    ACTIONS(478), 1,
-      anon_sym_LPAREN,
-  [1967] = 1,
-    ACTIONS(480), 1,
+  [2193] = 1,
+    ACTIONS(540), 1,
+      anon_sym_COLON,
+  [2197] = 1,
+    ACTIONS(542), 1,
       anon_sym_GT,
-  [1971] = 1,
-    ACTIONS(482), 1,
-      anon_sym_RBRACK,
-  [1975] = 1,
-    ACTIONS(484), 1,
+  [2201] = 1,
+    ACTIONS(544), 1,
       sym_loop_name,
-  [1979] = 1,
-    ACTIONS(486), 1,
+  [2205] = 1,
+    ACTIONS(546), 1,
+      anon_sym_GT,
+  [2209] = 1,
+    ACTIONS(548), 1,
       sym_balise_name,
-  [1983] = 1,
-    ACTIONS(488), 1,
-      sym_loop_name,
-  [1987] = 1,
-    ACTIONS(490), 1,
-      anon_sym_RBRACE,
-  [1991] = 1,
-    ACTIONS(492), 1,
-      anon_sym_RBRACE,
 };
 
 static const uint32_t ts_small_parse_table_map[] = {
@@ -3012,8 +3191,8 @@ static const uint32_t ts_small_parse_table_map[] = {
   [SMALL_STATE(11)] = 325,
   [SMALL_STATE(12)] = 352,
   [SMALL_STATE(13)] = 379,
-  [SMALL_STATE(14)] = 404,
-  [SMALL_STATE(15)] = 429,
+  [SMALL_STATE(14)] = 400,
+  [SMALL_STATE(15)] = 425,
   [SMALL_STATE(16)] = 450,
   [SMALL_STATE(17)] = 471,
   [SMALL_STATE(18)] = 491,
@@ -3041,370 +3220,425 @@ static const uint32_t ts_small_parse_table_map[] = {
   [SMALL_STATE(40)] = 931,
   [SMALL_STATE(41)] = 951,
   [SMALL_STATE(42)] = 971,
-  [SMALL_STATE(43)] = 995,
-  [SMALL_STATE(44)] = 1019,
-  [SMALL_STATE(45)] = 1040,
-  [SMALL_STATE(46)] = 1061,
-  [SMALL_STATE(47)] = 1082,
-  [SMALL_STATE(48)] = 1103,
-  [SMALL_STATE(49)] = 1124,
-  [SMALL_STATE(50)] = 1145,
+  [SMALL_STATE(43)] = 991,
+  [SMALL_STATE(44)] = 1011,
+  [SMALL_STATE(45)] = 1031,
+  [SMALL_STATE(46)] = 1051,
+  [SMALL_STATE(47)] = 1071,
+  [SMALL_STATE(48)] = 1091,
+  [SMALL_STATE(49)] = 1115,
+  [SMALL_STATE(50)] = 1139,
   [SMALL_STATE(51)] = 1160,
-  [SMALL_STATE(52)] = 1175,
-  [SMALL_STATE(53)] = 1190,
-  [SMALL_STATE(54)] = 1206,
-  [SMALL_STATE(55)] = 1220,
-  [SMALL_STATE(56)] = 1232,
-  [SMALL_STATE(57)] = 1246,
-  [SMALL_STATE(58)] = 1258,
-  [SMALL_STATE(59)] = 1274,
-  [SMALL_STATE(60)] = 1286,
-  [SMALL_STATE(61)] = 1300,
-  [SMALL_STATE(62)] = 1316,
-  [SMALL_STATE(63)] = 1330,
-  [SMALL_STATE(64)] = 1346,
-  [SMALL_STATE(65)] = 1360,
-  [SMALL_STATE(66)] = 1376,
-  [SMALL_STATE(67)] = 1392,
-  [SMALL_STATE(68)] = 1408,
-  [SMALL_STATE(69)] = 1422,
-  [SMALL_STATE(70)] = 1438,
-  [SMALL_STATE(71)] = 1452,
-  [SMALL_STATE(72)] = 1466,
-  [SMALL_STATE(73)] = 1478,
-  [SMALL_STATE(74)] = 1492,
-  [SMALL_STATE(75)] = 1508,
-  [SMALL_STATE(76)] = 1522,
-  [SMALL_STATE(77)] = 1535,
-  [SMALL_STATE(78)] = 1548,
-  [SMALL_STATE(79)] = 1561,
-  [SMALL_STATE(80)] = 1572,
-  [SMALL_STATE(81)] = 1585,
-  [SMALL_STATE(82)] = 1592,
-  [SMALL_STATE(83)] = 1599,
-  [SMALL_STATE(84)] = 1612,
-  [SMALL_STATE(85)] = 1623,
-  [SMALL_STATE(86)] = 1636,
-  [SMALL_STATE(87)] = 1649,
-  [SMALL_STATE(88)] = 1656,
-  [SMALL_STATE(89)] = 1663,
-  [SMALL_STATE(90)] = 1670,
-  [SMALL_STATE(91)] = 1683,
-  [SMALL_STATE(92)] = 1696,
-  [SMALL_STATE(93)] = 1706,
-  [SMALL_STATE(94)] = 1712,
-  [SMALL_STATE(95)] = 1722,
-  [SMALL_STATE(96)] = 1728,
-  [SMALL_STATE(97)] = 1738,
-  [SMALL_STATE(98)] = 1744,
-  [SMALL_STATE(99)] = 1754,
-  [SMALL_STATE(100)] = 1760,
-  [SMALL_STATE(101)] = 1770,
-  [SMALL_STATE(102)] = 1776,
-  [SMALL_STATE(103)] = 1782,
-  [SMALL_STATE(104)] = 1788,
-  [SMALL_STATE(105)] = 1794,
-  [SMALL_STATE(106)] = 1804,
-  [SMALL_STATE(107)] = 1814,
-  [SMALL_STATE(108)] = 1824,
-  [SMALL_STATE(109)] = 1830,
-  [SMALL_STATE(110)] = 1840,
-  [SMALL_STATE(111)] = 1846,
-  [SMALL_STATE(112)] = 1853,
-  [SMALL_STATE(113)] = 1860,
-  [SMALL_STATE(114)] = 1867,
-  [SMALL_STATE(115)] = 1874,
-  [SMALL_STATE(116)] = 1881,
-  [SMALL_STATE(117)] = 1888,
-  [SMALL_STATE(118)] = 1895,
-  [SMALL_STATE(119)] = 1899,
-  [SMALL_STATE(120)] = 1903,
-  [SMALL_STATE(121)] = 1907,
-  [SMALL_STATE(122)] = 1911,
-  [SMALL_STATE(123)] = 1915,
-  [SMALL_STATE(124)] = 1919,
-  [SMALL_STATE(125)] = 1923,
-  [SMALL_STATE(126)] = 1927,
-  [SMALL_STATE(127)] = 1931,
-  [SMALL_STATE(128)] = 1935,
-  [SMALL_STATE(129)] = 1939,
-  [SMALL_STATE(130)] = 1943,
-  [SMALL_STATE(131)] = 1947,
-  [SMALL_STATE(132)] = 1951,
-  [SMALL_STATE(133)] = 1955,
-  [SMALL_STATE(134)] = 1959,
-  [SMALL_STATE(135)] = 1963,
-  [SMALL_STATE(136)] = 1967,
-  [SMALL_STATE(137)] = 1971,
-  [SMALL_STATE(138)] = 1975,
-  [SMALL_STATE(139)] = 1979,
-  [SMALL_STATE(140)] = 1983,
-  [SMALL_STATE(141)] = 1987,
-  [SMALL_STATE(142)] = 1991,
+  [SMALL_STATE(52)] = 1181,
+  [SMALL_STATE(53)] = 1202,
+  [SMALL_STATE(54)] = 1223,
+  [SMALL_STATE(55)] = 1244,
+  [SMALL_STATE(56)] = 1265,
+  [SMALL_STATE(57)] = 1280,
+  [SMALL_STATE(58)] = 1295,
+  [SMALL_STATE(59)] = 1310,
+  [SMALL_STATE(60)] = 1326,
+  [SMALL_STATE(61)] = 1340,
+  [SMALL_STATE(62)] = 1352,
+  [SMALL_STATE(63)] = 1368,
+  [SMALL_STATE(64)] = 1380,
+  [SMALL_STATE(65)] = 1394,
+  [SMALL_STATE(66)] = 1408,
+  [SMALL_STATE(67)] = 1424,
+  [SMALL_STATE(68)] = 1438,
+  [SMALL_STATE(69)] = 1454,
+  [SMALL_STATE(70)] = 1470,
+  [SMALL_STATE(71)] = 1484,
+  [SMALL_STATE(72)] = 1500,
+  [SMALL_STATE(73)] = 1514,
+  [SMALL_STATE(74)] = 1530,
+  [SMALL_STATE(75)] = 1544,
+  [SMALL_STATE(76)] = 1560,
+  [SMALL_STATE(77)] = 1576,
+  [SMALL_STATE(78)] = 1592,
+  [SMALL_STATE(79)] = 1606,
+  [SMALL_STATE(80)] = 1620,
+  [SMALL_STATE(81)] = 1634,
+  [SMALL_STATE(82)] = 1646,
+  [SMALL_STATE(83)] = 1662,
+  [SMALL_STATE(84)] = 1674,
+  [SMALL_STATE(85)] = 1688,
+  [SMALL_STATE(86)] = 1702,
+  [SMALL_STATE(87)] = 1715,
+  [SMALL_STATE(88)] = 1726,
+  [SMALL_STATE(89)] = 1739,
+  [SMALL_STATE(90)] = 1746,
+  [SMALL_STATE(91)] = 1759,
+  [SMALL_STATE(92)] = 1772,
+  [SMALL_STATE(93)] = 1779,
+  [SMALL_STATE(94)] = 1786,
+  [SMALL_STATE(95)] = 1799,
+  [SMALL_STATE(96)] = 1812,
+  [SMALL_STATE(97)] = 1825,
+  [SMALL_STATE(98)] = 1836,
+  [SMALL_STATE(99)] = 1843,
+  [SMALL_STATE(100)] = 1850,
+  [SMALL_STATE(101)] = 1863,
+  [SMALL_STATE(102)] = 1876,
+  [SMALL_STATE(103)] = 1886,
+  [SMALL_STATE(104)] = 1892,
+  [SMALL_STATE(105)] = 1902,
+  [SMALL_STATE(106)] = 1908,
+  [SMALL_STATE(107)] = 1914,
+  [SMALL_STATE(108)] = 1924,
+  [SMALL_STATE(109)] = 1934,
+  [SMALL_STATE(110)] = 1940,
+  [SMALL_STATE(111)] = 1950,
+  [SMALL_STATE(112)] = 1960,
+  [SMALL_STATE(113)] = 1970,
+  [SMALL_STATE(114)] = 1980,
+  [SMALL_STATE(115)] = 1986,
+  [SMALL_STATE(116)] = 1996,
+  [SMALL_STATE(117)] = 2006,
+  [SMALL_STATE(118)] = 2016,
+  [SMALL_STATE(119)] = 2022,
+  [SMALL_STATE(120)] = 2028,
+  [SMALL_STATE(121)] = 2038,
+  [SMALL_STATE(122)] = 2048,
+  [SMALL_STATE(123)] = 2054,
+  [SMALL_STATE(124)] = 2060,
+  [SMALL_STATE(125)] = 2066,
+  [SMALL_STATE(126)] = 2073,
+  [SMALL_STATE(127)] = 2080,
+  [SMALL_STATE(128)] = 2087,
+  [SMALL_STATE(129)] = 2094,
+  [SMALL_STATE(130)] = 2101,
+  [SMALL_STATE(131)] = 2105,
+  [SMALL_STATE(132)] = 2109,
+  [SMALL_STATE(133)] = 2113,
+  [SMALL_STATE(134)] = 2117,
+  [SMALL_STATE(135)] = 2121,
+  [SMALL_STATE(136)] = 2125,
+  [SMALL_STATE(137)] = 2129,
+  [SMALL_STATE(138)] = 2133,
+  [SMALL_STATE(139)] = 2137,
+  [SMALL_STATE(140)] = 2141,
+  [SMALL_STATE(141)] = 2145,
+  [SMALL_STATE(142)] = 2149,
+  [SMALL_STATE(143)] = 2153,
+  [SMALL_STATE(144)] = 2157,
+  [SMALL_STATE(145)] = 2161,
+  [SMALL_STATE(146)] = 2165,
+  [SMALL_STATE(147)] = 2169,
+  [SMALL_STATE(148)] = 2173,
+  [SMALL_STATE(149)] = 2177,
+  [SMALL_STATE(150)] = 2181,
+  [SMALL_STATE(151)] = 2185,
+  [SMALL_STATE(152)] = 2189,
+  [SMALL_STATE(153)] = 2193,
+  [SMALL_STATE(154)] = 2197,
+  [SMALL_STATE(155)] = 2201,
+  [SMALL_STATE(156)] = 2205,
+  [SMALL_STATE(157)] = 2209,
 };
 
 static const TSParseActionEntry ts_parse_actions[] = {
   [0] = {.entry = {.count = 0, .reusable = false}},
   [1] = {.entry = {.count = 1, .reusable = false}}, RECOVER(),
   [3] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_template, 0, 0, 0),
-  [5] = {.entry = {.count = 1, .reusable = true}}, SHIFT(112),
-  [7] = {.entry = {.count = 1, .reusable = true}}, SHIFT(33),
-  [9] = {.entry = {.count = 1, .reusable = true}}, SHIFT(123),
-  [11] = {.entry = {.count = 1, .reusable = true}}, SHIFT(132),
-  [13] = {.entry = {.count = 1, .reusable = true}}, SHIFT(134),
-  [15] = {.entry = {.count = 1, .reusable = true}}, SHIFT(140),
-  [17] = {.entry = {.count = 1, .reusable = true}}, SHIFT(138),
-  [19] = {.entry = {.count = 1, .reusable = true}}, SHIFT(84),
-  [21] = {.entry = {.count = 1, .reusable = true}}, SHIFT(59),
-  [23] = {.entry = {.count = 1, .reusable = true}}, SHIFT(130),
-  [25] = {.entry = {.count = 1, .reusable = true}}, SHIFT(116),
-  [27] = {.entry = {.count = 1, .reusable = true}}, SHIFT(117),
+  [5] = {.entry = {.count = 1, .reusable = true}}, SHIFT(126),
+  [7] = {.entry = {.count = 1, .reusable = true}}, SHIFT(19),
+  [9] = {.entry = {.count = 1, .reusable = true}}, SHIFT(140),
+  [11] = {.entry = {.count = 1, .reusable = true}}, SHIFT(141),
+  [13] = {.entry = {.count = 1, .reusable = true}}, SHIFT(143),
+  [15] = {.entry = {.count = 1, .reusable = true}}, SHIFT(149),
+  [17] = {.entry = {.count = 1, .reusable = true}}, SHIFT(134),
+  [19] = {.entry = {.count = 1, .reusable = true}}, SHIFT(87),
+  [21] = {.entry = {.count = 1, .reusable = true}}, SHIFT(63),
+  [23] = {.entry = {.count = 1, .reusable = true}}, SHIFT(142),
+  [25] = {.entry = {.count = 1, .reusable = true}}, SHIFT(108),
+  [27] = {.entry = {.count = 1, .reusable = true}}, SHIFT(115),
   [29] = {.entry = {.count = 1, .reusable = false}}, SHIFT(2),
   [31] = {.entry = {.count = 1, .reusable = true}}, SHIFT(14),
   [33] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_template, 1, 0, 0),
   [35] = {.entry = {.count = 1, .reusable = false}}, SHIFT(3),
   [37] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0),
-  [39] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(112),
-  [42] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(33),
-  [45] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(123),
-  [48] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(132),
-  [51] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(134),
-  [54] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(140),
-  [57] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(138),
-  [60] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(84),
-  [63] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(59),
-  [66] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(130),
-  [69] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(116),
-  [72] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(117),
+  [39] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(126),
+  [42] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(19),
+  [45] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(140),
+  [48] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(141),
+  [51] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(143),
+  [54] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(149),
+  [57] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(134),
+  [60] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(87),
+  [63] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(63),
+  [66] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(142),
+  [69] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(108),
+  [72] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(115),
   [75] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(3),
   [78] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_template_repeat1, 2, 0, 0), SHIFT_REPEAT(14),
-  [81] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 3, 0, 2),
-  [83] = {.entry = {.count = 1, .reusable = true}}, SHIFT(7),
-  [85] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 3, 0, 2),
-  [87] = {.entry = {.count = 1, .reusable = true}}, SHIFT(58),
+  [81] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 3, 0, 3),
+  [83] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 3, 0, 3),
+  [85] = {.entry = {.count = 1, .reusable = true}}, SHIFT(62),
+  [87] = {.entry = {.count = 1, .reusable = true}}, SHIFT(7),
   [89] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 2, 0, 1),
-  [91] = {.entry = {.count = 1, .reusable = true}}, SHIFT(8),
-  [93] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 2, 0, 1),
-  [95] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 4, 0, 2),
-  [97] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 4, 0, 2),
-  [99] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 3, 0, 1),
-  [101] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 3, 0, 1),
-  [103] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 4, 0, 1),
-  [105] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 4, 0, 1),
-  [107] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_balise_shorthand_repeat1, 2, 0, 0),
-  [109] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_balise_shorthand_repeat1, 2, 0, 0),
-  [111] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_balise_shorthand_repeat1, 2, 0, 0), SHIFT_REPEAT(58),
-  [114] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 5, 0, 2),
-  [116] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 5, 0, 2),
-  [118] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_content_repeat1, 2, 0, 0),
-  [120] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_content_repeat1, 2, 0, 0),
-  [122] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_content_repeat1, 2, 0, 0), SHIFT_REPEAT(13),
-  [125] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_content, 1, 0, 0),
-  [127] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_content, 1, 0, 0),
-  [129] = {.entry = {.count = 1, .reusable = true}}, SHIFT(13),
-  [131] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_shorthand_params, 2, 0, 0),
-  [133] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_shorthand_params, 2, 0, 0),
-  [135] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_shorthand_params, 3, 0, 4),
-  [137] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_shorthand_params, 3, 0, 4),
-  [139] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_open, 6, 0, 5),
-  [141] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_open, 6, 0, 5),
-  [143] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_include_tag, 3, 0, 0),
-  [145] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_include_tag, 3, 0, 0),
-  [147] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_multi_block, 3, 0, 0),
-  [149] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_multi_block, 3, 0, 0),
-  [151] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_translation, 3, 0, 0),
-  [153] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_translation, 3, 0, 0),
-  [155] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 3, 0, 1),
-  [157] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 3, 0, 1),
-  [159] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_multi_block, 2, 0, 0),
-  [161] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_multi_block, 2, 0, 0),
-  [163] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_include_tag, 4, 0, 0),
-  [165] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_include_tag, 4, 0, 0),
-  [167] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 4, 0, 2),
-  [169] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 4, 0, 2),
-  [171] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 4, 0, 1),
-  [173] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 4, 0, 1),
-  [175] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_comment, 2, 0, 0),
-  [177] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_comment, 2, 0, 0),
-  [179] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 5, 0, 2),
-  [181] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 5, 0, 2),
-  [183] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 5, 0, 1),
-  [185] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 5, 0, 1),
-  [187] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_comment, 3, 0, 0),
-  [189] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_comment, 3, 0, 0),
-  [191] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_close, 3, 0, 1),
-  [193] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_close, 3, 0, 1),
-  [195] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_conditional_open, 3, 0, 1),
-  [197] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_conditional_open, 3, 0, 1),
-  [199] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 6, 0, 2),
-  [201] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 6, 0, 2),
-  [203] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_conditional_close, 1, 0, 0),
-  [205] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_conditional_close, 1, 0, 0),
-  [207] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 6, 0, 1),
-  [209] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 6, 0, 1),
-  [211] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_open, 7, 0, 5),
-  [213] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_open, 7, 0, 5),
-  [215] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_conditional_close, 3, 0, 1),
-  [217] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_conditional_close, 3, 0, 1),
-  [219] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 7, 0, 2),
-  [221] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 7, 0, 2),
-  [223] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 7, 0, 1),
-  [225] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 7, 0, 1),
-  [227] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_open, 8, 0, 5),
-  [229] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_open, 8, 0, 5),
-  [231] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 8, 0, 2),
-  [233] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 8, 0, 2),
-  [235] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_alternative, 3, 0, 1),
-  [237] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_alternative, 3, 0, 1),
-  [239] = {.entry = {.count = 1, .reusable = true}}, SHIFT(21),
-  [241] = {.entry = {.count = 1, .reusable = true}}, SHIFT(69),
-  [243] = {.entry = {.count = 1, .reusable = true}}, SHIFT(49),
-  [245] = {.entry = {.count = 1, .reusable = true}}, SHIFT(129),
-  [247] = {.entry = {.count = 1, .reusable = true}}, SHIFT(66),
-  [249] = {.entry = {.count = 1, .reusable = true}}, SHIFT(24),
-  [251] = {.entry = {.count = 1, .reusable = true}}, SHIFT(44),
-  [253] = {.entry = {.count = 1, .reusable = true}}, SHIFT(67),
-  [255] = {.entry = {.count = 1, .reusable = true}}, SHIFT(27),
-  [257] = {.entry = {.count = 1, .reusable = true}}, SHIFT(61),
-  [259] = {.entry = {.count = 1, .reusable = true}}, SHIFT(28),
-  [261] = {.entry = {.count = 1, .reusable = true}}, SHIFT(63),
-  [263] = {.entry = {.count = 1, .reusable = true}}, SHIFT(32),
-  [265] = {.entry = {.count = 1, .reusable = true}}, SHIFT(53),
-  [267] = {.entry = {.count = 1, .reusable = true}}, SHIFT(25),
-  [269] = {.entry = {.count = 1, .reusable = true}}, SHIFT(74),
-  [271] = {.entry = {.count = 1, .reusable = true}}, SHIFT(18),
+  [91] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 2, 0, 1),
+  [93] = {.entry = {.count = 1, .reusable = true}}, SHIFT(9),
+  [95] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_balise_shorthand_repeat1, 2, 0, 0),
+  [97] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_balise_shorthand_repeat1, 2, 0, 0),
+  [99] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_balise_shorthand_repeat1, 2, 0, 0), SHIFT_REPEAT(62),
+  [102] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 4, 0, 5),
+  [104] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 4, 0, 5),
+  [106] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 3, 0, 1),
+  [108] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 3, 0, 1),
+  [110] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 3, 0, 2),
+  [112] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 3, 0, 2),
+  [114] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 4, 0, 2),
+  [116] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 4, 0, 2),
+  [118] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 4, 0, 3),
+  [120] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 4, 0, 3),
+  [122] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_shorthand, 5, 0, 5),
+  [124] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise_shorthand, 5, 0, 5),
+  [126] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_shorthand_params, 2, 0, 0),
+  [128] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_shorthand_params, 2, 0, 0),
+  [130] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_content, 1, 0, 0),
+  [132] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_content, 1, 0, 0),
+  [134] = {.entry = {.count = 1, .reusable = true}}, SHIFT(15),
+  [136] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_content_repeat1, 2, 0, 0),
+  [138] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_content_repeat1, 2, 0, 0),
+  [140] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_content_repeat1, 2, 0, 0), SHIFT_REPEAT(15),
+  [143] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_shorthand_params, 3, 0, 6),
+  [145] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_shorthand_params, 3, 0, 6),
+  [147] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_open, 6, 0, 7),
+  [149] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_open, 6, 0, 7),
+  [151] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_include_tag, 3, 0, 0),
+  [153] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_include_tag, 3, 0, 0),
+  [155] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_conditional_close, 1, 0, 0),
+  [157] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_conditional_close, 1, 0, 0),
+  [159] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_multi_block, 3, 0, 0),
+  [161] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_multi_block, 3, 0, 0),
+  [163] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_translation, 3, 0, 0),
+  [165] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_translation, 3, 0, 0),
+  [167] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 3, 0, 1),
+  [169] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 3, 0, 1),
+  [171] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_multi_block, 2, 0, 0),
+  [173] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_multi_block, 2, 0, 0),
+  [175] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_include_tag, 4, 0, 0),
+  [177] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_include_tag, 4, 0, 0),
+  [179] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 4, 0, 1),
+  [181] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 4, 0, 1),
+  [183] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 4, 0, 2),
+  [185] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 4, 0, 2),
+  [187] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 4, 0, 3),
+  [189] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 4, 0, 3),
+  [191] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_comment, 2, 0, 0),
+  [193] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_comment, 2, 0, 0),
+  [195] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 5, 0, 2),
+  [197] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 5, 0, 2),
+  [199] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 5, 0, 1),
+  [201] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 5, 0, 1),
+  [203] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 5, 0, 3),
+  [205] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 5, 0, 3),
+  [207] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 5, 0, 5),
+  [209] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 5, 0, 5),
+  [211] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_comment, 3, 0, 0),
+  [213] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_comment, 3, 0, 0),
+  [215] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_close, 3, 0, 1),
+  [217] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_close, 3, 0, 1),
+  [219] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_conditional_open, 3, 0, 1),
+  [221] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_conditional_open, 3, 0, 1),
+  [223] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 6, 0, 2),
+  [225] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 6, 0, 2),
+  [227] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 6, 0, 1),
+  [229] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 6, 0, 1),
+  [231] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 6, 0, 5),
+  [233] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 6, 0, 5),
+  [235] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 6, 0, 3),
+  [237] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 6, 0, 3),
+  [239] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_open, 7, 0, 7),
+  [241] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_open, 7, 0, 7),
+  [243] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_conditional_close, 3, 0, 1),
+  [245] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_conditional_close, 3, 0, 1),
+  [247] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 7, 0, 2),
+  [249] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 7, 0, 2),
+  [251] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 7, 0, 5),
+  [253] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 7, 0, 5),
+  [255] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 7, 0, 3),
+  [257] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 7, 0, 3),
+  [259] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_open, 8, 0, 7),
+  [261] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_open, 8, 0, 7),
+  [263] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise, 8, 0, 5),
+  [265] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_balise, 8, 0, 5),
+  [267] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop_alternative, 3, 0, 1),
+  [269] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop_alternative, 3, 0, 1),
+  [271] = {.entry = {.count = 1, .reusable = true}}, SHIFT(22),
   [273] = {.entry = {.count = 1, .reusable = true}}, SHIFT(76),
-  [275] = {.entry = {.count = 1, .reusable = true}}, SHIFT(79),
-  [277] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_balise_repeat1, 2, 0, 0),
-  [279] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_balise_repeat1, 2, 0, 0), SHIFT_REPEAT(69),
-  [282] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_balise_repeat1, 2, 0, 0), SHIFT_REPEAT(114),
-  [285] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_include_tag_repeat1, 2, 0, 0),
-  [287] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_include_tag_repeat1, 2, 0, 0), SHIFT_REPEAT(76),
-  [290] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_include_tag_repeat1, 2, 0, 0), SHIFT_REPEAT(111),
-  [293] = {.entry = {.count = 1, .reusable = true}}, SHIFT(37),
-  [295] = {.entry = {.count = 1, .reusable = true}}, SHIFT(96),
-  [297] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_filter, 2, 0, 1),
-  [299] = {.entry = {.count = 1, .reusable = true}}, SHIFT(65),
-  [301] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_balise_repeat2, 2, 0, 0),
-  [303] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_balise_repeat2, 2, 0, 0), SHIFT_REPEAT(129),
-  [306] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_balise_repeat2, 2, 0, 0), SHIFT_REPEAT(115),
-  [309] = {.entry = {.count = 1, .reusable = true}}, SHIFT(19),
-  [311] = {.entry = {.count = 1, .reusable = true}}, SHIFT(72),
-  [313] = {.entry = {.count = 1, .reusable = true}}, SHIFT(80),
-  [315] = {.entry = {.count = 1, .reusable = true}}, SHIFT(15),
-  [317] = {.entry = {.count = 1, .reusable = true}}, SHIFT(90),
-  [319] = {.entry = {.count = 1, .reusable = true}}, SHIFT(22),
-  [321] = {.entry = {.count = 1, .reusable = true}}, SHIFT(57),
-  [323] = {.entry = {.count = 1, .reusable = true}}, SHIFT(17),
-  [325] = {.entry = {.count = 1, .reusable = true}}, SHIFT(78),
-  [327] = {.entry = {.count = 1, .reusable = true}}, SHIFT(100),
-  [329] = {.entry = {.count = 1, .reusable = true}}, SHIFT(105),
-  [331] = {.entry = {.count = 1, .reusable = true}}, SHIFT(34),
-  [333] = {.entry = {.count = 1, .reusable = true}}, SHIFT(106),
-  [335] = {.entry = {.count = 1, .reusable = true}}, SHIFT(103),
-  [337] = {.entry = {.count = 1, .reusable = true}}, SHIFT(35),
-  [339] = {.entry = {.count = 1, .reusable = true}}, SHIFT(92),
-  [341] = {.entry = {.count = 1, .reusable = true}}, SHIFT(89),
-  [343] = {.entry = {.count = 1, .reusable = true}}, SHIFT(109),
-  [345] = {.entry = {.count = 1, .reusable = true}}, SHIFT(98),
-  [347] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_multi_block_repeat1, 2, 0, 0),
-  [349] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_multi_block_repeat1, 2, 0, 0), SHIFT_REPEAT(72),
-  [352] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_loop_open_repeat1, 2, 0, 0),
-  [354] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_loop_open_repeat1, 2, 0, 0), SHIFT_REPEAT(78),
-  [357] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_loop_open_repeat1, 2, 0, 0), SHIFT_REPEAT(113),
-  [360] = {.entry = {.count = 1, .reusable = true}}, SHIFT(107),
-  [362] = {.entry = {.count = 1, .reusable = true}}, SHIFT(83),
-  [364] = {.entry = {.count = 1, .reusable = true}}, SHIFT(94),
-  [366] = {.entry = {.count = 1, .reusable = true}}, SHIFT(93),
-  [368] = {.entry = {.count = 1, .reusable = true}}, SHIFT(86),
-  [370] = {.entry = {.count = 1, .reusable = true}}, SHIFT(85),
-  [372] = {.entry = {.count = 1, .reusable = true}}, SHIFT(23),
-  [374] = {.entry = {.count = 1, .reusable = true}}, SHIFT(97),
-  [376] = {.entry = {.count = 1, .reusable = true}}, SHIFT(77),
-  [378] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_params, 3, 0, 4),
-  [380] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_include_param_block, 3, 0, 3),
-  [382] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_include_params, 1, 0, 0),
-  [384] = {.entry = {.count = 1, .reusable = true}}, SHIFT(91),
-  [386] = {.entry = {.count = 1, .reusable = true}}, SHIFT(111),
-  [388] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_criteria_value, 1, 0, 0),
-  [390] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__nested_brace_content, 2, 0, 0), SHIFT_REPEAT(94),
-  [393] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym__nested_brace_content, 2, 0, 0),
-  [395] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__nested_brace_content, 2, 0, 0), SHIFT_REPEAT(86),
-  [398] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_params, 2, 0, 0),
-  [400] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_param_content, 1, 0, 0),
-  [402] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_criteria_value_repeat1, 2, 0, 0), SHIFT_REPEAT(80),
-  [405] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_criteria_value_repeat1, 2, 0, 0),
-  [407] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_criteria_value_repeat1, 2, 0, 0), SHIFT_REPEAT(91),
-  [410] = {.entry = {.count = 1, .reusable = true}}, SHIFT(39),
-  [412] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_criteria_value_repeat1, 3, 0, 0),
-  [414] = {.entry = {.count = 1, .reusable = true}}, SHIFT(95),
-  [416] = {.entry = {.count = 1, .reusable = true}}, SHIFT(126),
-  [418] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_filter, 3, 0, 1),
-  [420] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym__nested_brace_content, 3, 0, 0),
-  [422] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_filter_params, 2, 0, 0),
-  [424] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_filter_params, 3, 0, 4),
-  [426] = {.entry = {.count = 1, .reusable = true}}, SHIFT(38),
-  [428] = {.entry = {.count = 1, .reusable = true}}, SHIFT(40),
-  [430] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_criteria, 3, 0, 4),
-  [432] = {.entry = {.count = 1, .reusable = true}}, SHIFT(137),
-  [434] = {.entry = {.count = 1, .reusable = true}}, SHIFT(26),
-  [436] = {.entry = {.count = 1, .reusable = true}}, SHIFT(139),
-  [438] = {.entry = {.count = 1, .reusable = true}}, SHIFT(42),
-  [440] = {.entry = {.count = 1, .reusable = true}}, SHIFT(122),
-  [442] = {.entry = {.count = 1, .reusable = true}}, SHIFT(5),
-  [444] = {.entry = {.count = 1, .reusable = true}}, SHIFT(119),
-  [446] = {.entry = {.count = 1, .reusable = true}}, SHIFT(60),
-  [448] = {.entry = {.count = 1, .reusable = true}}, SHIFT(31),
-  [450] = {.entry = {.count = 1, .reusable = true}}, SHIFT(36),
-  [452] = {.entry = {.count = 1, .reusable = true}}, SHIFT(4),
-  [454] = {.entry = {.count = 1, .reusable = true}}, SHIFT(135),
-  [456] = {.entry = {.count = 1, .reusable = true}}, SHIFT(82),
-  [458] = {.entry = {.count = 1, .reusable = true}},  ACCEPT_INPUT(),
-  [460] = {.entry = {.count = 1, .reusable = true}}, SHIFT(102),
-  [462] = {.entry = {.count = 1, .reusable = true}}, SHIFT(41),
-  [464] = {.entry = {.count = 1, .reusable = true}}, SHIFT(104),
-  [466] = {.entry = {.count = 1, .reusable = true}}, SHIFT(55),
-  [468] = {.entry = {.count = 1, .reusable = true}}, SHIFT(133),
-  [470] = {.entry = {.count = 1, .reusable = true}}, SHIFT(110),
-  [472] = {.entry = {.count = 1, .reusable = true}}, SHIFT(136),
-  [474] = {.entry = {.count = 1, .reusable = true}}, SHIFT(20),
-  [476] = {.entry = {.count = 1, .reusable = true}}, SHIFT(120),
-  [478] = {.entry = {.count = 1, .reusable = true}}, SHIFT(118),
-  [480] = {.entry = {.count = 1, .reusable = true}}, SHIFT(30),
-  [482] = {.entry = {.count = 1, .reusable = true}}, SHIFT(29),
-  [484] = {.entry = {.count = 1, .reusable = true}}, SHIFT(127),
-  [486] = {.entry = {.count = 1, .reusable = true}}, SHIFT(43),
-  [488] = {.entry = {.count = 1, .reusable = true}}, SHIFT(121),
-  [490] = {.entry = {.count = 1, .reusable = true}}, SHIFT(81),
-  [492] = {.entry = {.count = 1, .reusable = true}}, SHIFT(16),
+  [275] = {.entry = {.count = 1, .reusable = true}}, SHIFT(137),
+  [277] = {.entry = {.count = 1, .reusable = true}}, SHIFT(73),
+  [279] = {.entry = {.count = 1, .reusable = true}}, SHIFT(53),
+  [281] = {.entry = {.count = 1, .reusable = true}}, SHIFT(27),
+  [283] = {.entry = {.count = 1, .reusable = true}}, SHIFT(59),
+  [285] = {.entry = {.count = 1, .reusable = true}}, SHIFT(55),
+  [287] = {.entry = {.count = 1, .reusable = true}}, SHIFT(25),
+  [289] = {.entry = {.count = 1, .reusable = true}}, SHIFT(82),
+  [291] = {.entry = {.count = 1, .reusable = true}}, SHIFT(38),
+  [293] = {.entry = {.count = 1, .reusable = true}}, SHIFT(77),
+  [295] = {.entry = {.count = 1, .reusable = true}}, SHIFT(31),
+  [297] = {.entry = {.count = 1, .reusable = true}}, SHIFT(71),
+  [299] = {.entry = {.count = 1, .reusable = true}}, SHIFT(26),
+  [301] = {.entry = {.count = 1, .reusable = true}}, SHIFT(75),
+  [303] = {.entry = {.count = 1, .reusable = true}}, SHIFT(29),
+  [305] = {.entry = {.count = 1, .reusable = true}}, SHIFT(66),
+  [307] = {.entry = {.count = 1, .reusable = true}}, SHIFT(32),
+  [309] = {.entry = {.count = 1, .reusable = true}}, SHIFT(69),
+  [311] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_include_tag_repeat1, 2, 0, 0),
+  [313] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_include_tag_repeat1, 2, 0, 0), SHIFT_REPEAT(96),
+  [316] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_include_tag_repeat1, 2, 0, 0), SHIFT_REPEAT(125),
+  [319] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_balise_repeat1, 2, 0, 0),
+  [321] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_balise_repeat1, 2, 0, 0), SHIFT_REPEAT(76),
+  [324] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_balise_repeat1, 2, 0, 0), SHIFT_REPEAT(127),
+  [327] = {.entry = {.count = 1, .reusable = true}}, SHIFT(18),
+  [329] = {.entry = {.count = 1, .reusable = true}}, SHIFT(96),
+  [331] = {.entry = {.count = 1, .reusable = true}}, SHIFT(97),
+  [333] = {.entry = {.count = 1, .reusable = true}}, SHIFT(110),
+  [335] = {.entry = {.count = 1, .reusable = true}}, SHIFT(20),
+  [337] = {.entry = {.count = 1, .reusable = true}}, SHIFT(83),
+  [339] = {.entry = {.count = 1, .reusable = true}}, SHIFT(88),
+  [341] = {.entry = {.count = 1, .reusable = true}}, SHIFT(13),
+  [343] = {.entry = {.count = 1, .reusable = true}}, SHIFT(86),
+  [345] = {.entry = {.count = 1, .reusable = true}}, SHIFT(23),
+  [347] = {.entry = {.count = 1, .reusable = true}}, SHIFT(61),
+  [349] = {.entry = {.count = 1, .reusable = true}}, SHIFT(17),
+  [351] = {.entry = {.count = 1, .reusable = true}}, SHIFT(100),
+  [353] = {.entry = {.count = 1, .reusable = true}}, SHIFT(111),
+  [355] = {.entry = {.count = 1, .reusable = true}}, SHIFT(112),
+  [357] = {.entry = {.count = 1, .reusable = true}}, SHIFT(36),
+  [359] = {.entry = {.count = 1, .reusable = true}}, SHIFT(113),
+  [361] = {.entry = {.count = 1, .reusable = true}}, SHIFT(114),
+  [363] = {.entry = {.count = 1, .reusable = true}}, SHIFT(116),
+  [365] = {.entry = {.count = 1, .reusable = true}}, SHIFT(39),
+  [367] = {.entry = {.count = 1, .reusable = true}}, SHIFT(117),
+  [369] = {.entry = {.count = 1, .reusable = true}}, SHIFT(40),
+  [371] = {.entry = {.count = 1, .reusable = true}}, SHIFT(102),
+  [373] = {.entry = {.count = 1, .reusable = true}}, SHIFT(93),
+  [375] = {.entry = {.count = 1, .reusable = true}}, SHIFT(43),
+  [377] = {.entry = {.count = 1, .reusable = true}}, SHIFT(120),
+  [379] = {.entry = {.count = 1, .reusable = true}}, SHIFT(104),
+  [381] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_loop_open_repeat1, 2, 0, 0),
+  [383] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_loop_open_repeat1, 2, 0, 0), SHIFT_REPEAT(100),
+  [386] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_loop_open_repeat1, 2, 0, 0), SHIFT_REPEAT(129),
+  [389] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_filter, 2, 0, 1),
+  [391] = {.entry = {.count = 1, .reusable = true}}, SHIFT(68),
+  [393] = {.entry = {.count = 1, .reusable = true}}, SHIFT(30),
+  [395] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_multi_block_repeat1, 2, 0, 0),
+  [397] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_multi_block_repeat1, 2, 0, 0), SHIFT_REPEAT(83),
+  [400] = {.entry = {.count = 1, .reusable = true}}, SHIFT(107),
+  [402] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_balise_repeat2, 2, 0, 0),
+  [404] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_balise_repeat2, 2, 0, 0), SHIFT_REPEAT(137),
+  [407] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_balise_repeat2, 2, 0, 0), SHIFT_REPEAT(128),
+  [410] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_param_content, 1, 0, 0),
+  [412] = {.entry = {.count = 1, .reusable = true}}, SHIFT(90),
+  [414] = {.entry = {.count = 1, .reusable = true}}, SHIFT(125),
+  [416] = {.entry = {.count = 1, .reusable = true}}, SHIFT(121),
+  [418] = {.entry = {.count = 1, .reusable = true}}, SHIFT(123),
+  [420] = {.entry = {.count = 1, .reusable = true}}, SHIFT(101),
+  [422] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_include_param_block, 3, 0, 4),
+  [424] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_criteria_value_repeat1, 2, 0, 0), SHIFT_REPEAT(88),
+  [427] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_criteria_value_repeat1, 2, 0, 0),
+  [429] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_criteria_value_repeat1, 2, 0, 0), SHIFT_REPEAT(90),
+  [432] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__nested_brace_content, 2, 0, 0), SHIFT_REPEAT(121),
+  [435] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym__nested_brace_content, 2, 0, 0),
+  [437] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__nested_brace_content, 2, 0, 0), SHIFT_REPEAT(91),
+  [440] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_params, 3, 0, 6),
+  [442] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_params, 2, 0, 0),
+  [444] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_criteria_value, 1, 0, 0),
+  [446] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_include_params, 1, 0, 0),
+  [448] = {.entry = {.count = 1, .reusable = true}}, SHIFT(95),
+  [450] = {.entry = {.count = 1, .reusable = true}}, SHIFT(24),
+  [452] = {.entry = {.count = 1, .reusable = true}}, SHIFT(94),
+  [454] = {.entry = {.count = 1, .reusable = true}}, SHIFT(103),
+  [456] = {.entry = {.count = 1, .reusable = true}}, SHIFT(91),
+  [458] = {.entry = {.count = 1, .reusable = true}}, SHIFT(45),
+  [460] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_criteria_value_repeat1, 3, 0, 0),
+  [462] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_filter, 3, 0, 1),
+  [464] = {.entry = {.count = 1, .reusable = true}}, SHIFT(37),
+  [466] = {.entry = {.count = 1, .reusable = true}}, SHIFT(155),
+  [468] = {.entry = {.count = 1, .reusable = true}}, SHIFT(48),
+  [470] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym__nested_brace_content, 3, 0, 0),
+  [472] = {.entry = {.count = 1, .reusable = true}}, SHIFT(42),
+  [474] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_filter_params, 2, 0, 0),
+  [476] = {.entry = {.count = 1, .reusable = true}}, SHIFT(5),
+  [478] = {.entry = {.count = 1, .reusable = true}}, SHIFT(44),
+  [480] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_filter_params, 3, 0, 6),
+  [482] = {.entry = {.count = 1, .reusable = true}}, SHIFT(46),
+  [484] = {.entry = {.count = 1, .reusable = true}}, SHIFT(124),
+  [486] = {.entry = {.count = 1, .reusable = true}}, SHIFT(145),
+  [488] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_criteria, 3, 0, 6),
+  [490] = {.entry = {.count = 1, .reusable = true}}, SHIFT(148),
+  [492] = {.entry = {.count = 1, .reusable = true}}, SHIFT(28),
+  [494] = {.entry = {.count = 1, .reusable = true}}, SHIFT(122),
+  [496] = {.entry = {.count = 1, .reusable = true}}, SHIFT(146),
+  [498] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_balise_namespace, 3, 0, 1),
+  [500] = {.entry = {.count = 1, .reusable = true}}, SHIFT(89),
+  [502] = {.entry = {.count = 1, .reusable = true}}, SHIFT(150),
+  [504] = {.entry = {.count = 1, .reusable = true}}, SHIFT(119),
+  [506] = {.entry = {.count = 1, .reusable = true}}, SHIFT(34),
+  [508] = {.entry = {.count = 1, .reusable = true}}, SHIFT(81),
+  [510] = {.entry = {.count = 1, .reusable = true}}, SHIFT(4),
+  [512] = {.entry = {.count = 1, .reusable = true}},  ACCEPT_INPUT(),
+  [514] = {.entry = {.count = 1, .reusable = true}}, SHIFT(131),
+  [516] = {.entry = {.count = 1, .reusable = true}}, SHIFT(136),
+  [518] = {.entry = {.count = 1, .reusable = true}}, SHIFT(152),
+  [520] = {.entry = {.count = 1, .reusable = true}}, SHIFT(154),
+  [522] = {.entry = {.count = 1, .reusable = true}}, SHIFT(92),
+  [524] = {.entry = {.count = 1, .reusable = true}}, SHIFT(109),
+  [526] = {.entry = {.count = 1, .reusable = true}}, SHIFT(151),
+  [528] = {.entry = {.count = 1, .reusable = true}}, SHIFT(16),
+  [530] = {.entry = {.count = 1, .reusable = true}}, SHIFT(33),
+  [532] = {.entry = {.count = 1, .reusable = true}}, SHIFT(156),
+  [534] = {.entry = {.count = 1, .reusable = true}}, SHIFT(47),
+  [536] = {.entry = {.count = 1, .reusable = true}}, SHIFT(64),
+  [538] = {.entry = {.count = 1, .reusable = true}}, SHIFT(21),
+  [540] = {.entry = {.count = 1, .reusable = true}}, SHIFT(132),
+  [542] = {.entry = {.count = 1, .reusable = true}}, SHIFT(35),
+  [544] = {.entry = {.count = 1, .reusable = true}}, SHIFT(153),
+  [546] = {.entry = {.count = 1, .reusable = true}}, SHIFT(41),
+  [548] = {.entry = {.count = 1, .reusable = true}}, SHIFT(49),
 };
 
 enum ts_external_scanner_symbol_identifiers {
-  ts_external_token__content_char = 0,
+  ts_external_token__content_run = 0,
   ts_external_token__spip_ws = 1,
   ts_external_token_shorthand_lbrace = 2,
+  ts_external_token_balise_modifier = 3,
 };
 
 static const TSSymbol ts_external_scanner_symbol_map[EXTERNAL_TOKEN_COUNT] = {
-  [ts_external_token__content_char] = sym__content_char,
+  [ts_external_token__content_run] = sym__content_run,
   [ts_external_token__spip_ws] = sym__spip_ws,
   [ts_external_token_shorthand_lbrace] = sym_shorthand_lbrace,
+  [ts_external_token_balise_modifier] = sym_balise_modifier,
 };
 
-static const bool ts_external_scanner_states[5][EXTERNAL_TOKEN_COUNT] = {
+static const bool ts_external_scanner_states[7][EXTERNAL_TOKEN_COUNT] = {
   [1] = {
-    [ts_external_token__content_char] = true,
+    [ts_external_token__content_run] = true,
     [ts_external_token__spip_ws] = true,
     [ts_external_token_shorthand_lbrace] = true,
+    [ts_external_token_balise_modifier] = true,
   },
   [2] = {
-    [ts_external_token__content_char] = true,
+    [ts_external_token__content_run] = true,
   },
   [3] = {
-    [ts_external_token__content_char] = true,
+    [ts_external_token__content_run] = true,
     [ts_external_token_shorthand_lbrace] = true,
+    [ts_external_token_balise_modifier] = true,
   },
   [4] = {
+    [ts_external_token__content_run] = true,
+    [ts_external_token_shorthand_lbrace] = true,
+  },
+  [5] = {
+    [ts_external_token__spip_ws] = true,
+    [ts_external_token_balise_modifier] = true,
+  },
+  [6] = {
     [ts_external_token__spip_ws] = true,
   },
 };
@@ -1,20 +1,25 @@
 /**
  * External scanner for tree-sitter-spip.
  *
- * Three external tokens:
- *   CONTENT_CHAR      — one character of HTML/text content (not SPIP)
+ * Four external tokens:
+ *   CONTENT_RUN       — a run of HTML/text content (not SPIP)
  *   SPIP_WS           — whitespace inside SPIP constructs (between criteria, etc.)
  *   SHORTHAND_LBRACE  — '{' when expected after a shorthand balise
+ *   BALISE_MODIFIER   — '*' or '**' right after a balise name
  */
 
 #include "tree_sitter/parser.h"
 
 enum TokenType {
-  CONTENT_CHAR,
+  CONTENT_RUN,
   SPIP_WS,
   SHORTHAND_LBRACE,
+  BALISE_MODIFIER,
 };
 
+// The scanner keeps no state between tokens: no payload is allocated and
+// serialization is empty, so incremental reparses never need to restore
+// scanner state before relexing an edited range.
 void *tree_sitter_spip_external_scanner_create(void) { return NULL; }
 void tree_sitter_spip_external_scanner_destroy(void *p) { (void)p; }
 unsigned tree_sitter_spip_external_scanner_serialize(void *p, char *b) {
@@ -28,6 +33,14 @@ static bool is_ws(int32_t c) {
   return c == ' ' || c == '\t' || c == '\n' || c == '\r';
 }
 
+/**
+ * Characters that can open a SPIP construct; at_spip_start() only needs
+ * to run on these.
+ */
+static bool may_start_spip(int32_t c) {
+  return c == '(' || c == '#' || c == '<' || c == '[' || c == ']';
+}
+
 /**
  * Check if current position starts a SPIP construct.
  */
@@ -118,6 +131,22 @@ bool tree_sitter_spip_external_scanner_scan(void *payload, TSLexer *lexer,
     return true;
   }
 
+  // ── BALISE_MODIFIER: '*' or '**' after a balise name ──
+  // Only valid directly after the name, so '*' following shorthand params
+  // (#TAG{x}*) still falls through to content.  Every external token is
+  // valid at once only during error recovery, where a '*' is content.
+  bool error_recovery = valid_symbols[CONTENT_RUN] && valid_symbols[SPIP_WS] &&
+                        valid_symbols[SHORTHAND_LBRACE] &&
+                        valid_symbols[BALISE_MODIFIER];
+  if (valid_symbols[BALISE_MODIFIER] && !error_recovery &&
+      lexer->lookahead == '*') {
+    lexer->advance(lexer, false);
+    if (lexer->lookahead == '*') lexer->advance(lexer, false);
+    lexer->mark_end(lexer);
+    lexer->result_symbol = BALISE_MODIFIER;
+    return true;
+  }
+
   // ── SPIP_WS: whitespace inside SPIP constructs ──
   if (valid_symbols[SPIP_WS] && is_ws(lexer->lookahead)) {
     lexer->mark_end(lexer);
@@ -151,14 +180,35 @@ bool tree_sitter_spip_external_scanner_scan(void *payload, TSLexer *lexer,
     return false;
   }
 
-  // ── CONTENT_CHAR: one character of non-SPIP content ──
-  if (!valid_symbols[CONTENT_CHAR]) return false;
-  if (at_spip_start(lexer)) return false;
+  // ── CONTENT_RUN: a run of non-SPIP content ──
+  // Everything up to the next SPIP construct (or EOF) is one token, so a
+  // block of HTML becomes a single leaf instead of one leaf per character.
+  if (!valid_symbols[CONTENT_RUN]) return false;
+
+  bool has_content = false;
+  for (;;) {
+    int32_t c = lexer->lookahead;
+    if (c == 0 && lexer->eof(lexer)) {
+      lexer->mark_end(lexer);
+      break;
+    }
+
+    // Fast path: most characters cannot open a construct, so skip them
+    // without marking the token end or peeking ahead.
+    if (!may_start_spip(c)) {
+      lexer->advance(lexer, false);
+      has_content = true;
+      continue;
+    }
+
+    lexer->mark_end(lexer);
+    if (at_spip_start(lexer)) break;
+
+    // at_spip_start() already stepped over the candidate while peeking.
+    has_content = true;
+  }
 
-  // Consume one character as content
-  lexer->mark_end(lexer);
-  lexer->advance(lexer, false);
-  lexer->mark_end(lexer);
-  lexer->result_symbol = CONTENT_CHAR;
+  if (!has_content) return false;
+  lexer->result_symbol = CONTENT_RUN;
   return true;
 }